@@ -32,18 +32,31 @@ _start_thumb:
   @ save return address
   PUSH  {LR}
 
-  @ clear bss section
-_bss_clear:
+  @ copy .iwram (load image in EWRAM -> 0x03000000) with DMA3, 32bit units
+_iwram_copy:
+  LDR  R0, =__iwram_lma
+  LDR  R1, =__iwram_start
+  LDR  R2, =__iwram_end
+  SUB  R2, R1
+  LSR  R2, #2
+  BEQ  _iwram_copy_exit
+  LDR  R3, =0x040000D4          @ DMA3SAD
+  STR  R0, [R3]
+  STR  R1, [R3, #4]             @ DMA3DAD
+  LDR  R0, =0x84000000          @ enable | 32bit
+  ORR  R2, R0
+  STR  R2, [R3, #8]             @ DMA3CNT (CPU halts until done)
+  NOP
+  NOP
+_iwram_copy_exit:
+
+  @ clear bss sections (both are word aligned by ereader.ld)
   LDR  R0, =__bss_start
   LDR  R1, =__bss_end
-  MOV  R2, #0
-_bss_clear_loop:
-  CMP  R0, R1
-  BEQ  _bss_clear_exit
-  STRB R2, [R0]
-  ADD  R0, #1
-  B    _bss_clear_loop
-_bss_clear_exit:
+  BL   _word_clear
+  LDR  R0, =__iwram_bss_start
+  LDR  R1, =__iwram_bss_end
+  BL   _word_clear
 
   @ restore return address
   POP  {R3}
@@ -53,6 +66,30 @@ _bss_clear_exit:
   LDR  R3, =main
   BX   R3
 
+  @ R0 = start, R1 = end (word aligned). 4 words per STMIA, then single words
+_word_clear:
+  MOV  R2, #0
+  MOV  R3, #0
+  PUSH {R4, R5}
+  MOV  R4, #0
+  MOV  R5, #0
+  SUB  R1, #16
+_word_clear_16:
+  CMP  R0, R1
+  BHI  _word_clear_tail
+  STMIA R0!, {R2-R5}
+  B    _word_clear_16
+_word_clear_tail:
+  ADD  R1, #16
+_word_clear_4:
+  CMP  R0, R1
+  BHS  _word_clear_exit
+  STMIA R0!, {R2}
+  B    _word_clear_4
+_word_clear_exit:
+  POP  {R4, R5}
+  BX   LR
+
   .ALIGN
 
   .POOL
@@ -0,0 +1,46 @@
+/* ---- animcheck：トゥイーンが所要フレームで終わるかの確認（HOST_BUILD） ----
+ * frames = 0（1 扱い）, 1, 2, 3, 255 で 1 本ずつ出し、frames + 1 回の anim_update で
+ * 消えること（終点を描いた次のフレームで終了）を確かめる。step は Q16 の切り捨てなので、
+ * 割り切れない frames では終点に揃える 1 フレームが足されて frames + 2 回まで許す。
+ * make hostcheck から呼ぶ。
+ *
+ *   build/animcheck_bin
+ */
+#include <stdio.h>
+
+#include "hostmem.h"
+#include "def.h"
+#include "anim.h"
+#include "oam.h"
+
+static int run_(int frames){
+  AnimDesc d = {0};
+  d.x0 = 0; d.y0 = 0; d.x1 = 100; d.y1 = 50;
+  d.frames = (u8)frames;
+  d.ease   = ANIM_EASE_OUT;
+  d.tag    = ANIM_TAG_DEAL;
+  anim_reset();
+  if (anim_spawn(&d) < 0) return -1;
+  int f = frames ? frames : 1;
+  for (int n = 1; n <= 300; ++n){
+    oam_begin_frame();
+    anim_update();
+    if (anim_count(ANIM_TAG_NONE, -1) == 0) return (n >= f + 1 && n <= f + 2) ? 0 : n;
+  }
+  return 300;
+}
+
+int main(void){
+  static const int kFrames[] = { 0, 1, 2, 3, 255 };
+  int bad = 0;
+  hostmem_reset();
+  for (int i = 0; i < (int)(sizeof(kFrames) / sizeof(kFrames[0])); ++i){
+    int r = run_(kFrames[i]);
+    if (r){
+      printf("animcheck: frames=%d did not finish as expected (%d)\n", kFrames[i], r);
+      bad++;
+    }
+  }
+  if (!bad) printf("[HOST] animcheck OK\n");
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+/* ---- facebench：カード表面の転送方式を比べる（HOST_BUILD） ----
+ * ・アトラス（重複除去済みタイルの集め転送）と、字形からの展開（cardface）で
+ *   同じ 16x32 4bpp が得られるかを 52 枚すべて確認する
+ * ・1 枚あたりの転送（dmaq に積んでフラッシュするまで）のホスト時間
+ * ・それぞれの持ち方でカード画像に載るバイト数
+ *
+ *   build/facebench_bin [繰り返し回数]
+ *
+ * アトラスを --proc-faces で作った場合は表面がアトラスに無いので、展開側だけを測る。
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hostmem.h"
+#include "sprite_bare.h"
+#include "def.h"
+#include "cards.h"
+#include "deck.h"
+#include "dmaq.h"
+#include "cardface.h"
+#include "card_glyphs.h"
+#include "obj_atlas.h"
+#include "lz77.h"
+
+static double now_ns_(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* 表面だけが使うタイル数（他のスプライトと共有しているタイルは数えない） */
+static int face_only_tiles_(void){
+  static u8 used_face[256], used_other[256];
+  for (int i=0;i<OBJ_ATLAS_SPRITE_COUNT;++i){
+    const ObjSpriteDesc* d = &objAtlasSprites[i];
+    const char* n = objAtlasNames[i];
+    int is_face = n && strchr("HDSC", n[0]) && n[1] == '_';
+    for (int t=0;t<d->tiles_per_frame;++t){
+      u8 ti = objAtlasTileIndex[d->index_first + t];
+      if (is_face) used_face[ti] = 1; else used_other[ti] = 1;
+    }
+  }
+  int n = 0;
+  for (int t=0;t<256;++t) if (used_face[t] && !used_other[t]) n++;
+  return n;
+}
+
+int main(int argc, char** argv){
+  int reps = (argc > 1) ? atoi(argv[1]) : 2000;
+  if (reps <= 0) reps = 1;
+  hostmem_reset();
+  lz77_unpack_wram(obj_atlasTilesLZ, obj_atlasTiles, "obj_atlas");
+
+  u8 deck[MAX_DECK];
+  int n = build_deck(deck);
+  u8* va = host_vram + 0x10000;               /* OBJ タイル 0 */
+  u8* vb = host_vram + 0x10000 + 32 * 32;     /* OBJ タイル 32 */
+
+  int faces = 0, in_atlas = 0, mismatch = 0;
+  double t_atlas = 0, t_proc = 0;
+  for (int i=0;i<n;++i){
+    u8 c = deck[i];
+    if (!cardface_supported(c)) continue;
+    faces++;
+
+    double t0 = now_ns_();
+    for (int r=0;r<reps;++r){ cardface_push(vb, c, DMAQ_PRIO_NORMAL); dmaq_flush(); }
+    t_proc += now_ns_() - t0;
+
+    int idx = objAtlasFindIndex(card_to_string(c));
+    if (idx < 0) continue;
+    const ObjSpriteDesc* d = &objAtlasSprites[idx];
+    in_atlas++;
+    t0 = now_ns_();
+    for (int r=0;r<reps;++r){
+      dmaq_push_tiles(va, obj_atlasTiles, &objAtlasTileIndex[d->index_first], CARDFACE_TILES, DMAQ_PRIO_NORMAL);
+      dmaq_flush();
+    }
+    t_atlas += now_ns_() - t0;
+    if (memcmp(va, vb, CARDFACE_TILES * 32) != 0){
+      printf("mismatch: %s\n", card_to_string(c));
+      mismatch++;
+    }
+  }
+
+  int glyph_bytes = (int)(sizeof(cardGlyphTplRow) + sizeof(cardGlyphTplWords) + sizeof(cardGlyphRank)
+                        + sizeof(cardGlyphPip) + sizeof(cardGlyphInk));
+  printf("faces            : %d (in atlas %d, mismatch %d)\n", faces, in_atlas, mismatch);
+  if (in_atlas){
+    int ft = face_only_tiles_();
+    printf("atlas faces      : %d B (%d face-only tiles x 32 + index %d x 8)\n",
+           ft * 32 + in_atlas * CARDFACE_TILES, ft, in_atlas);
+    printf("upload atlas     : %.1f ns/face (host)\n", t_atlas / ((double)in_atlas * reps));
+  }
+  printf("procedural faces : %d B (template %d + rank %d + pip %d + ink %d)\n", glyph_bytes,
+         (int)(sizeof(cardGlyphTplRow) + sizeof(cardGlyphTplWords)), (int)sizeof(cardGlyphRank),
+         (int)sizeof(cardGlyphPip), (int)sizeof(cardGlyphInk));
+  printf("upload procedural: %.1f ns/face (host)\n", t_proc / ((double)faces * reps));
+  printf("atlas total      : %d B tiles + %d B index\n", (int)obj_atlasTilesLen, (int)obj_atlasTileIndexLen);
+  return mismatch ? 1 : 0;
+}
@@ -0,0 +1,32 @@
+#include "hostmem.h"
+#include "erapi.h"
+#include "sprite_bare.h"
+
+/* ERAPI は BG0 をキャラ 0 / スクリーン 31 に置く想定で再現する */
+#define HOST_BG_SCREEN_BLOCK 31
+
+void host_erapi_load_bg(int layer, const struct _ERAPI_BACKGROUND* bg){
+  if (layer != 0 || !bg) return;
+  const uint8_t* gfx = (const uint8_t*)bg->data_gfx;
+  const uint8_t* pal = (const uint8_t*)bg->data_pal;
+  const uint8_t* map = (const uint8_t*)bg->data_map;
+
+  uint32_t gfx_bytes = (uint32_t)bg->tiles * 32;
+  uint32_t pal_bytes = (uint32_t)bg->palettes * 32;
+  uint32_t map_bytes = 32 * 20 * 2;
+  uint8_t* screen = host_vram + HOST_BG_SCREEN_BLOCK * 0x800;
+
+  for (uint32_t i=0;i<gfx_bytes;++i) host_vram[i] = gfx[i];
+  for (uint32_t i=0;i<pal_bytes;++i) ((uint8_t*)host_pal)[i] = pal[i];
+  for (uint32_t i=0;i<map_bytes;++i) screen[i] = map[i];
+  hostmem_count(host_vram, gfx_bytes + map_bytes);
+  hostmem_count(host_pal, pal_bytes);
+
+  REG_IO16(REG_OFS_BG0CNT) = (uint16_t)(HOST_BG_SCREEN_BLOCK << 8);
+}
+
+void host_erapi_layer_show(int layer, int on){
+  if (layer < 0 || layer > 3) return;
+  uint16_t bit = (uint16_t)(DCNT_BG0 << layer);
+  if (on) REG_DISPCNT |= bit; else REG_DISPCNT &= (uint16_t)~bit;
+}
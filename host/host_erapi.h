@@ -0,0 +1,27 @@
+#ifndef HOST_ERAPI_H
+#define HOST_ERAPI_H
+
+/* ---- ERAPI の代役（HOST_BUILD） ----
+ * 描画に影響する呼び出し（背景読み込み・レイヤー表示）だけをホストメモリ上で再現し、
+ * サウンドや入力などは何もしない。
+ */
+#include "def.h"
+
+struct _ERAPI_BACKGROUND;
+void host_erapi_load_bg(int layer, const struct _ERAPI_BACKGROUND* bg);
+void host_erapi_layer_show(int layer, int on);
+
+#define ERAPI_LoadBackgroundCustom(a,b)    host_erapi_load_bg((a), (b))
+#define ERAPI_LayerShow(a)                 host_erapi_layer_show((a), 1)
+#define ERAPI_LayerHide(a)                 host_erapi_layer_show((a), 0)
+#define ERAPI_RenderFrame(a)               ((void)(a))
+#define ERAPI_FadeIn(a)                    ((void)(a))
+#define ERAPI_FadeOut(a)                   ((void)(a))
+#define ERAPI_InitMemory(a)                ((void)(a))
+#define ERAPI_SetBackgroundMode(a)         ((void)(a))
+#define ERAPI_PlaySoundSystem(a)           ((void)(a))
+#define ERAPI_SetSoundVolume(a,b)          ((void)(a), (void)(b))
+#define ERAPI_GetKeyStateRaw()             0u
+#define ERAPI_GetKeyStateSticky()          0u
+
+#endif /* HOST_ERAPI_H */
@@ -0,0 +1,47 @@
+#include "hostmem.h"
+#include "sprite_bare.h"
+
+uint16_t host_io  [0x400 / 2];
+uint16_t host_pal [0x400 / 2];
+uint8_t  host_vram[0x18000];
+uint16_t host_oam [0x400 / 2];
+
+uint32_t host_bytes[HOSTMEM_REGIONS];
+const char* const host_region_names[HOSTMEM_REGIONS] = {
+    "io", "pal", "bg_vram", "obj_vram", "oam", "other"
+};
+
+static int in_(const volatile void* p, const void* base, uint32_t size){
+  uintptr_t a = (uintptr_t)p, b = (uintptr_t)base;
+  return a >= b && a < b + size;
+}
+
+void hostmem_reset(void){
+  for (uint32_t i=0;i<sizeof(host_io)/2;++i)  host_io[i]  = 0;
+  for (uint32_t i=0;i<sizeof(host_pal)/2;++i) host_pal[i] = 0;
+  for (uint32_t i=0;i<sizeof(host_vram);++i)  host_vram[i] = 0;
+  for (uint32_t i=0;i<sizeof(host_oam)/2;++i) host_oam[i] = 0;
+  hostmem_begin_frame();
+}
+
+void hostmem_begin_frame(void){
+  for (int r=0;r<HOSTMEM_REGIONS;++r) host_bytes[r] = 0;
+}
+
+void hostmem_count(const volatile void* dst, uint32_t bytes){
+  int r = HOSTMEM_OTHER;
+  if      (in_(dst, host_io,  sizeof(host_io)))             r = HOSTMEM_IO;
+  else if (in_(dst, host_pal, sizeof(host_pal)))            r = HOSTMEM_PAL;
+  else if (in_(dst, host_vram, 0x10000))                    r = HOSTMEM_BG_VRAM;
+  else if (in_(dst, host_vram + 0x10000, 0x8000))           r = HOSTMEM_OBJ_VRAM;
+  else if (in_(dst, host_oam, sizeof(host_oam)))            r = HOSTMEM_OAM;
+  host_bytes[r] += bytes;
+}
+
+/* 実機の DMA3 の代わり：コピーして数える */
+void spr_dma_copy32(void* dst, const void* src, uint32_t words){
+  volatile uint32_t* d = (volatile uint32_t*)dst;
+  const uint32_t*    s = (const uint32_t*)src;
+  for (uint32_t i=0;i<words;++i) d[i] = s[i];
+  hostmem_count(dst, words * 4);
+}
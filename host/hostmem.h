@@ -0,0 +1,35 @@
+#ifndef HOSTMEM_H
+#define HOSTMEM_H
+
+/* ---- ホスト確認用のメモリ（HOST_BUILD） ----
+ * sprite_bare.h の I/O・パレット・VRAM・OAM の先頭をこの配列に差し替える。
+ * 実機と同じオフセットで読み書きされるので、描画結果をそのまま合成できる。
+ * 転送（spr_dma_copy32）は書き込み先の領域ごとにバイト数を数える。
+ */
+#include <stdint.h>
+
+enum {
+    HOSTMEM_IO = 0,
+    HOSTMEM_PAL,
+    HOSTMEM_BG_VRAM,
+    HOSTMEM_OBJ_VRAM,
+    HOSTMEM_OAM,
+    HOSTMEM_OTHER,
+    HOSTMEM_REGIONS
+};
+
+extern uint16_t host_io  [0x400 / 2];
+extern uint16_t host_pal [0x400 / 2];
+extern uint8_t  host_vram[0x18000];
+extern uint16_t host_oam [0x400 / 2];
+
+/* 領域ごとの書き込みバイト数（hostmem_begin_frame で 0 に戻る） */
+extern uint32_t host_bytes[HOSTMEM_REGIONS];
+extern const char* const host_region_names[HOSTMEM_REGIONS];
+
+void hostmem_reset(void);
+void hostmem_begin_frame(void);
+/* dst が属する領域に bytes を加算 */
+void hostmem_count(const volatile void* dst, uint32_t bytes);
+
+#endif /* HOSTMEM_H */
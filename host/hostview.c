@@ -0,0 +1,411 @@
+/* ---- hostview：render の出力をホストで確認する ----
+ * 実機の代わりに hostmem の配列へ描画させ、VBlank 転送（dmaq_flush）後の
+ * パレット・VRAM・OAM・BG マップ・合成レジスタから 240x160 の画面を組み立てる。
+ *
+ *   build/hostview [出力先] [フレーム数] [PNG 間隔] [乱数シード]
+ *
+ * 標準出力：フレームごとの領域別書き込みバイト数と画面の CRC32（CSV）
+ * 出力先：  frame_NNNN.png（PNG 間隔ごと）
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hostmem.h"
+#include "sprite_bare.h"
+#include "def.h"
+#include "cards.h"
+#include "deck.h"
+#include "game.h"
+#include "render.h"
+#include "dmaq.h"
+#include "blend.h"
+#include "hud.h"
+#include "hwstate.h"
+#include "obj_atlas.h"
+#include "lz77.h"
+#include "scratch.h"
+#include "prof.h"
+#include "rng.h"
+#include "arena.h"
+#include "memwatch.h"
+
+extern int  game_consume_pending_sfx(int* out_id);
+extern int  game_consume_pending_banner(const char** out_name, int* out_player);
+extern void render_set_banner_player(int player);
+
+#define SCR_W 240
+#define SCR_H 160
+
+/* ================= 合成 ================= */
+
+enum { LAYER_BG0 = 0, LAYER_OBJ = 4, LAYER_BD = 5 };
+
+typedef struct {
+    uint16_t color;
+    uint8_t  filled;
+    uint8_t  semi;      /* 半透明 OBJ */
+    uint8_t  prio;
+} ObjPixel;
+
+static uint16_t s_fb[SCR_H][SCR_W];
+static ObjPixel s_obj[SCR_H][SCR_W];
+
+static const uint8_t kObjSize[3][4][2] = {
+    { {8,8},  {16,16}, {32,32}, {64,64} },   /* 正方形 */
+    { {16,8}, {32,8},  {32,16}, {64,32} },   /* 横長 */
+    { {8,16}, {8,32},  {16,32}, {32,64} },   /* 縦長 */
+};
+
+static uint8_t tile_px_(uint32_t vram_ofs, int tile, int px, int py){
+  uint8_t b = host_vram[(vram_ofs + (uint32_t)tile * 32 + (uint32_t)py * 4 + (uint32_t)(px >> 1)) % sizeof(host_vram)];
+  return (px & 1) ? (uint8_t)(b >> 4) : (uint8_t)(b & 15);
+}
+
+static void draw_objs_(void){
+  for (int y=0;y<SCR_H;++y) for (int x=0;x<SCR_W;++x) s_obj[y][x].filled = 0;
+  if (!(host_io[0] & DCNT_OBJ)) return;
+
+  /* 番号の大きい方から描き、小さい番号で上書き（小さいほど手前） */
+  for (int n=127;n>=0;--n){
+    const uint16_t* a = &host_oam[n*4];
+    int affine = (a[0] >> 8) & 1, dbl = (a[0] >> 9) & 1;
+    if (!affine && dbl) continue;                   /* 非表示 */
+    int shape = a[0] >> 14, size = a[1] >> 14;
+    if (shape == 3) continue;
+    int w = kObjSize[shape][size][0], h = kObjSize[shape][size][1];
+    int bw = (affine && dbl) ? w*2 : w, bh = (affine && dbl) ? h*2 : h;
+    int oy = a[0] & 0xFF, ox = a[1] & 0x1FF;
+    if (oy + bh > 256) oy -= 256;
+    if (ox >= 240 && ox + bw > 512) ox -= 512;
+    int semi = ((a[0] >> 10) & 3) == 1;
+    int tile = a[2] & 0x3FF, pal = a[2] >> 12, prio = (a[2] >> 10) & 3;
+
+    int16_t pa = 256, pb = 0, pc = 0, pd = 256;
+    if (affine){
+      int m = (a[1] >> 9) & 31;
+      pa = (int16_t)host_oam[m*16 + 3];  pb = (int16_t)host_oam[m*16 + 7];
+      pc = (int16_t)host_oam[m*16 + 11]; pd = (int16_t)host_oam[m*16 + 15];
+    }
+    int hf = !affine && ((a[1] >> 12) & 1), vf = !affine && ((a[1] >> 13) & 1);
+
+    for (int sy=0; sy<bh; ++sy){
+      int y = oy + sy; if (y < 0 || y >= SCR_H) continue;
+      for (int sx=0; sx<bw; ++sx){
+        int x = ox + sx; if (x < 0 || x >= SCR_W) continue;
+        int tx, ty;
+        if (affine){
+          int dx = sx - bw/2, dy = sy - bh/2;
+          tx = ((pa*dx + pb*dy) >> 8) + w/2;
+          ty = ((pc*dx + pd*dy) >> 8) + h/2;
+          if (tx < 0 || ty < 0 || tx >= w || ty >= h) continue;
+        }else{
+          tx = hf ? w-1-sx : sx;
+          ty = vf ? h-1-sy : sy;
+        }
+        /* 1D マッピング */
+        int t = tile + (ty >> 3) * (w >> 3) + (tx >> 3);
+        uint8_t ci = tile_px_(0x10000, t, tx & 7, ty & 7);
+        if (!ci) continue;
+        ObjPixel* o = &s_obj[y][x];
+        o->color  = host_pal[256 + pal*16 + ci];
+        o->filled = 1;
+        o->semi   = (uint8_t)semi;
+        o->prio   = (uint8_t)prio;
+      }
+    }
+  }
+}
+
+static int bg0_px_(int x, int y, uint16_t* out){
+  if (!(host_io[0] & DCNT_BG0)) return 0;
+  uint16_t cnt = host_io[REG_OFS_BG0CNT/2];
+  uint32_t cb = BGCNT_CHAR_BASE(cnt) * 0x4000u, sb = BGCNT_SCREEN_BASE(cnt) * 0x800u;
+  int mx = (x >> 3) & 31, my = (y >> 3) & 31;
+  uint16_t se = (uint16_t)(host_vram[sb + (my*32 + mx)*2] | (host_vram[sb + (my*32 + mx)*2 + 1] << 8));
+  int px = x & 7, py = y & 7;
+  if (se & 0x0400) px = 7 - px;
+  if (se & 0x0800) py = 7 - py;
+  uint8_t ci = tile_px_(cb, se & 0x3FF, px, py);
+  if (!ci) return 0;
+  *out = host_pal[(se >> 12) * 16 + ci];
+  return 1;
+}
+
+static uint16_t mix_alpha_(uint16_t a, uint16_t b, int eva, int evb){
+  if (eva > 16) eva = 16;
+  if (evb > 16) evb = 16;
+  uint16_t r = 0;
+  for (int s=0;s<15;s+=5){
+    int c = ((((a >> s) & 31) * eva) + (((b >> s) & 31) * evb)) >> 4;
+    if (c > 31) c = 31;
+    r |= (uint16_t)(c << s);
+  }
+  return r;
+}
+
+static uint16_t mix_bright_(uint16_t a, int ey, int up){
+  if (ey > 16) ey = 16;
+  uint16_t r = 0;
+  for (int s=0;s<15;s+=5){
+    int c = (a >> s) & 31;
+    c = up ? c + (((31 - c) * ey) >> 4) : c - ((c * ey) >> 4);
+    r |= (uint16_t)(c << s);
+  }
+  return r;
+}
+
+static void compose_(void){
+  uint16_t bldcnt = host_io[REG_OFS_BLDCNT/2];
+  uint16_t alpha  = host_io[REG_OFS_BLDALPHA/2];
+  int eva = alpha & 31, evb = (alpha >> 8) & 31, ey = host_io[REG_OFS_BLDY/2] & 31;
+  int mode = (bldcnt >> 6) & 3;
+  int bg_prio = host_io[REG_OFS_BG0CNT/2] & 3;
+
+  draw_objs_();
+  for (int y=0;y<SCR_H;++y){
+    for (int x=0;x<SCR_W;++x){
+      /* 上から2層を決める */
+      uint16_t c[2]; int l[2]; int n = 0;
+      const ObjPixel* o = &s_obj[y][x];
+      uint16_t bgc;
+      int has_bg = bg0_px_(x, y, &bgc);
+      if (o->filled && (!has_bg || o->prio <= bg_prio)){ c[n] = o->color; l[n++] = LAYER_OBJ; }
+      if (has_bg){ c[n] = bgc; l[n++] = LAYER_BG0; }
+      if (n < 2 && o->filled && l[0] != LAYER_OBJ){ c[n] = o->color; l[n++] = LAYER_OBJ; }
+      if (n < 2){ c[n] = host_pal[0]; l[n++] = LAYER_BD; }
+
+      uint16_t out = c[0];
+      int top_in  = (bldcnt >> l[0]) & 1;
+      int bot_in  = (bldcnt >> (8 + l[1])) & 1;
+      if (l[0] == LAYER_OBJ && o->semi && bot_in){
+        out = mix_alpha_(c[0], c[1], eva, evb);
+      }else if (top_in){
+        if      (mode == 1 && bot_in) out = mix_alpha_(c[0], c[1], eva, evb);
+        else if (mode == 2)           out = mix_bright_(c[0], ey, 1);
+        else if (mode == 3)           out = mix_bright_(c[0], ey, 0);
+      }
+      s_fb[y][x] = out;
+    }
+  }
+}
+
+/* ================= PNG（無圧縮 deflate） ================= */
+
+static uint32_t s_crc_tab[256];
+
+static void crc_init_(void){
+  for (uint32_t n=0;n<256;++n){
+    uint32_t c = n;
+    for (int k=0;k<8;++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+    s_crc_tab[n] = c;
+  }
+}
+
+static uint32_t crc_update_(uint32_t crc, const uint8_t* p, size_t n){
+  crc = ~crc;
+  while (n--) crc = s_crc_tab[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void put_be32_(uint8_t* p, uint32_t v){
+  p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static void write_chunk_(FILE* f, const char* type, const uint8_t* data, uint32_t len){
+  uint8_t hdr[8];
+  put_be32_(hdr, len);
+  for (int i=0;i<4;++i) hdr[4+i] = (uint8_t)type[i];
+  fwrite(hdr, 1, 8, f);
+  if (len) fwrite(data, 1, len, f);
+  uint32_t crc = crc_update_(0, hdr + 4, 4);
+  crc = crc_update_(crc, data, len);
+  uint8_t t[4]; put_be32_(t, crc);
+  fwrite(t, 1, 4, f);
+}
+
+static int write_png_(const char* path){
+  enum { ROW = 1 + SCR_W * 3, RAW = ROW * SCR_H };
+  static uint8_t raw[RAW];
+  static uint8_t z[2 + RAW + (RAW / 65535 + 1) * 5 + 4];
+
+  for (int y=0;y<SCR_H;++y){
+    uint8_t* r = &raw[y * ROW];
+    r[0] = 0;   /* filter none */
+    for (int x=0;x<SCR_W;++x){
+      uint16_t c = s_fb[y][x];
+      int cr = c & 31, cg = (c >> 5) & 31, cb = (c >> 10) & 31;
+      r[1 + x*3 + 0] = (uint8_t)((cr << 3) | (cr >> 2));
+      r[1 + x*3 + 1] = (uint8_t)((cg << 3) | (cg >> 2));
+      r[1 + x*3 + 2] = (uint8_t)((cb << 3) | (cb >> 2));
+    }
+  }
+
+  /* zlib：stored ブロックを並べるだけ */
+  uint32_t zn = 0, a1 = 1, a2 = 0;
+  z[zn++] = 0x78; z[zn++] = 0x01;
+  for (uint32_t pos=0; pos<RAW; ){
+    uint32_t len = RAW - pos; if (len > 65535) len = 65535;
+    z[zn++] = (pos + len == RAW) ? 1 : 0;
+    z[zn++] = (uint8_t)len; z[zn++] = (uint8_t)(len >> 8);
+    z[zn++] = (uint8_t)~len; z[zn++] = (uint8_t)(~len >> 8);
+    for (uint32_t i=0;i<len;++i){
+      uint8_t b = raw[pos + i];
+      z[zn++] = b;
+      a1 = (a1 + b) % 65521; a2 = (a2 + a1) % 65521;
+    }
+    pos += len;
+  }
+  put_be32_(&z[zn], (a2 << 16) | a1); zn += 4;
+
+  FILE* f = fopen(path, "wb");
+  if (!f) return 0;
+  static const uint8_t sig[8] = { 0x89,'P','N','G','\r','\n',0x1A,'\n' };
+  fwrite(sig, 1, 8, f);
+  uint8_t ihdr[13];
+  put_be32_(ihdr, SCR_W); put_be32_(ihdr + 4, SCR_H);
+  ihdr[8] = 8; ihdr[9] = 2; ihdr[10] = 0; ihdr[11] = 0; ihdr[12] = 0;   /* 8bit RGB */
+  write_chunk_(f, "IHDR", ihdr, 13);
+  write_chunk_(f, "IDAT", z, zn);
+  write_chunk_(f, "IEND", NULL, 0);
+  fclose(f);
+  return 1;
+}
+
+/* ================= 1ゲーム分を回す（main.c と同じ順序） ================= */
+
+int main(int argc, char** argv){
+  const char* outdir = (argc > 1) ? argv[1] : "build/hostview";
+  int frames = (argc > 2) ? atoi(argv[2]) : 900;
+  int every  = (argc > 3) ? atoi(argv[3]) : 30;
+  if (every <= 0) every = 1;
+  u32 seed   = (argc > 4) ? (u32)strtoul(argv[4], NULL, 0) : 0;
+
+  crc_init_();
+  hostmem_reset();
+  prof_init();
+  render_init_ui();
+
+  /* 乱数は固定のシード（既定 0 = 毎回同じ配り → 画像を比較できる） */
+  rng_set_seed(seed);
+  fprintf(stderr, "[RNG] seed 0x%08X\n", (unsigned)rng_get_seed());
+  u8 deck[MAX_DECK];
+  int deck_n = build_deck(deck);
+  shuffle_deck(deck, deck_n);
+  Hand hands[PLAYERS];
+  deal_round_robin(deck, deck_n, 1, hands);
+  for (int p=0; p<PLAYERS; ++p) sort_hand(&hands[p]);
+
+  static GameState g;
+  game_init(&g, hands, 0);
+  const Hand* myhand = &hands[0];
+
+  int back_tile_base = 0, banner_shown = 0;
+  render_init_vram(myhand, &back_tile_base);
+  hud_init();
+  for (;;){   /* main.c と同じく持ち越しがなくなるまで流してから回収 */
+    hw_state_commit();
+    dmaq_flush();
+    DmaqStats ds;
+    dmaq_get_stats(&ds);
+    if (!ds.pending) break;
+  }
+  scratch_reclaim_init();
+  {
+    void* heap = scratch_alloc(ARENA_BYTES);
+    arena_init(heap, ARENA_BYTES);
+    memwatch_init(heap, ARENA_BYTES);
+  }
+  blend_init();
+  blend_fade_in(1);
+  blend_update();
+  hw_state_commit();
+
+  printf("frame");
+  for (int r=0;r<HOSTMEM_REGIONS;++r) printf(",%s", host_region_names[r]);
+  printf(",reg_writes,crc32\n");
+
+  HwStateStats hs;
+  hw_state_get_stats(&hs);
+  u32 prev_reg = hs.reg_writes;
+
+  for (int f=0; f<frames; ++f){
+    hostmem_begin_frame();
+    arena_reset(ARENA_FRAME);
+
+    if (game_step_deal(&g)){
+      int p = g.deal_last;
+      render_anim_deal(p, g.visible[p] - 1, hands[p].cards[g.visible[p] - 1]);
+    }
+    int who = g.turn_player;
+    Hand before = hands[who];
+    if (game_step_turn(&g, hands)){
+      render_anim_play(who, g.field_cards, g.field_count, &before);
+    }
+    if (g.turn_player != who) arena_reset(ARENA_TURN);
+    int id;
+    game_consume_pending_sfx(&id);
+    const char* fxname = NULL; int pidx = -1;
+    if (game_consume_pending_banner(&fxname, &pidx)){
+      render_set_banner_player(pidx);
+      render_show_role_sprite(fxname);
+      banner_shown = 1;
+    }
+    if (banner_shown && g.fx_display_time == 0){
+      render_hide_role_sprite();
+      banner_shown = 0;
+    }
+    for (int i=0;i<myhand->count;++i){
+      u8 c = myhand->cards[i];
+      int v = OBJ_PAL_NORMAL;
+      if (g.deal_done){
+        if (!game_card_can_follow(&g, c)) v = OBJ_PAL_DIMMED;
+        else if (g.turn_player == 0)      v = OBJ_PAL_HIGHLIGHT;
+      }
+      render_set_card_pal(c, v);
+    }
+    hud_update(&g);
+    render_frame(myhand, g.visible, g.field_visible, g.field_count);
+
+    /* VBlank：待たせたレジスタと積んだ転送を反映してから画面を組み立てる（frame_on_vblank と同じ） */
+    hw_state_commit();
+    dmaq_flush();
+    memwatch_mark(MEMW_VBLANK);
+    compose_();
+
+    hw_state_get_stats(&hs);
+    uint32_t crc = crc_update_(0, (const uint8_t*)s_fb, sizeof(s_fb));
+    printf("%d", f);
+    for (int r=0;r<HOSTMEM_REGIONS;++r) printf(",%u", (unsigned)host_bytes[r]);
+    printf(",%u,%08x\n", (unsigned)(hs.reg_writes - prev_reg), (unsigned)crc);
+    prev_reg = hs.reg_writes;
+
+    if (f % every == 0){
+      char path[512];
+      snprintf(path, sizeof(path), "%s/frame_%04d.png", outdir, f);
+      if (!write_png_(path)){ fprintf(stderr, "hostview: cannot write %s\n", path); return 1; }
+    }
+  }
+  /* 起動時の展開（hud / msgtext のグリフは最初の VBlank で VRAM へ直接展開される） */
+  {
+    Lz77Stats lz;
+    lz77_get_stats(&lz);
+    fprintf(stderr, "[LZ77] boot: %u streams, %u -> %u bytes\n",
+            (unsigned)lz.calls, (unsigned)lz.packed_bytes, (unsigned)lz.raw_bytes);
+    const Lz77Record* r;
+    int n = lz77_get_records(&r);
+    for (int i=0;i<n;++i){
+      fprintf(stderr, "[LZ77]   %-10s %5u -> %5u bytes, %u cycles\n", r[i].name,
+              (unsigned)r[i].packed_bytes, (unsigned)r[i].raw_bytes, (unsigned)r[i].cycles);
+    }
+  }
+  ArenaStats as;
+  arena_get_stats(&as);
+  fprintf(stderr, "[ARENA] %u bytes: turn peak %u, frame peak %u, high water %u, failures %u\n",
+          (unsigned)as.capacity, (unsigned)as.peak[ARENA_TURN], (unsigned)as.peak[ARENA_FRAME],
+          (unsigned)as.high_water, (unsigned)as.failures);
+#ifdef MEMWATCH
+  fprintf(stderr, "[MEMW] arena touched %u / %u bytes\n",
+          (unsigned)memwatch.heap_touched, (unsigned)memwatch.heap_bytes);
+#endif
+  return 0;
+}
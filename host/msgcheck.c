@@ -0,0 +1,88 @@
+/* ---- msgcheck：メッセージのマップコピーの確認（HOST_BUILD） ----
+ * msg_glyphs（make assets の生成物）のグリフを BG キャラへ展開し、msgtext_draw で置いた
+ * BG0 のエントリが MSGT_<KEY> のタイル番号列そのものになること、透明タイルと msgtext_clear で
+ * 元の背景に戻ること、展開したグリフ（■）の中身が文字＋右下の影になっていることを確かめる。
+ * make hostcheck から呼ぶ。
+ *
+ *   build/msgcheck_bin
+ */
+#include <stdio.h>
+
+#include "hostmem.h"
+#include "def.h"
+#include "sprite_bare.h"
+#include "bgmap.h"
+#include "dmaq.h"
+#include "msgtext.h"
+#include "msg_glyphs.h"
+#include "hud_tiles.h"
+
+#define SCREEN_BLOCK 31
+#define FIRST_TILE   16            /* 背景画像の次のキャラ（ここからグリフが並ぶ） */
+#define PAL_BANK     2
+#define BASE_SE      ((u16)0x0005) /* 元の背景のエントリ（restore で戻る値） */
+
+static u16 s_base[BGMAP_COLS * BGMAP_ROWS];
+
+static u16 screen_(int x, int y){
+  const u16* sb = (const u16*)(host_vram + SCREEN_BLOCK * 0x800);
+  return sb[y * BGMAP_COLS + x];
+}
+
+static void vblank_(void){
+  bgmap_commit();
+  dmaq_flush();
+}
+
+/* (x,y) に置いた msg の各セルが期待どおりか。違ったセルの数を返す */
+static int check_msg_(int x, int y, const u16* msg){
+  int bad = 0;
+  for (int i = 0; i < msg[0]; ++i){
+    u16 t = msg[2 + i];
+    u16 want = t ? (u16)BG_SE(FIRST_TILE + t, PAL_BANK) : BASE_SE;
+    if (screen_(x + i, y) != want) bad++;
+  }
+  return bad;
+}
+
+static int check_clear_(int x, int y, const u16* msg){
+  int bad = 0;
+  for (int i = 0; i < msg[0]; ++i) if (screen_(x + i, y) != BASE_SE) bad++;
+  return bad;
+}
+
+int main(void){
+  int bad = 0;
+  hostmem_reset();
+  REG_IO16(REG_OFS_BG0CNT) = (u16)(SCREEN_BLOCK << 8);
+  /* 背景は ERAPI が読み込んだ体で、スクリーンにも同じものを置いておく */
+  u16* sb = (u16*)(host_vram + SCREEN_BLOCK * 0x800);
+  for (int i = 0; i < BGMAP_COLS * BGMAP_ROWS; ++i) s_base[i] = sb[i] = BASE_SE;
+  bgmap_init(s_base, FIRST_TILE);
+
+  if (!msgtext_load(msg_glyphsTilesLZ, msg_glyphsTileCount, hud_tilesPal, PAL_BANK)){
+    printf("msgcheck: msgtext_load failed\n");
+    return 1;
+  }
+  msgtext_draw(2, 3, MSGT_TIME_LABEL);
+  msgtext_draw(2, 5, MSGT_TARGET_LABEL);
+  msgtext_draw(2, 7, MSGT_CLEAR);
+  vblank_();
+  if (check_msg_(2, 3, MSGT_TIME_LABEL))   { printf("msgcheck: TIME_LABEL map mismatch\n"); bad++; }
+  if (check_msg_(2, 5, MSGT_TARGET_LABEL)) { printf("msgcheck: TARGET_LABEL map mismatch\n"); bad++; }
+  if (check_msg_(2, 7, MSGT_CLEAR))        { printf("msgcheck: CLEAR is not transparent\n"); bad++; }
+
+  /* ■ は 7x7 の塗りなので、1 行目は文字 7 ドット、8 行目は影 7 ドット（右へ 1 ずれる） */
+  const u32* card = (const u32*)(host_vram + (FIRST_TILE + MSGT_CARD[2]) * 32);
+  if (card[0] != 0x01111111u || card[7] != 0x22222220u){
+    printf("msgcheck: glyph tile decoded wrong (%08X %08X)\n", (unsigned)card[0], (unsigned)card[7]);
+    bad++;
+  }
+
+  msgtext_clear(2, 3, MSGT_TIME_LABEL);
+  vblank_();
+  if (check_clear_(2, 3, MSGT_TIME_LABEL)){ printf("msgcheck: clear did not restore the background\n"); bad++; }
+
+  if (!bad) printf("[HOST] msgcheck OK (%d tiles)\n", msg_glyphsTileCount);
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,121 @@
+/* ---- rngbench：乱数の範囲取りを比べる（HOST_BUILD） ----
+ * ・偏り：span = 0xC0000000 で span/3 未満が出る割合（一様なら 0.3333）。
+ *   旧実装（xorshift32 + 剰余）は 0.50 になり、rng_stream_below（xoshiro128** + Lemire）は 0.3331。
+ *   Lemire に替えた理由はこの偏りの解消で、速さではない
+ * ・ストリームの重なり：RNG_STREAM_USER から並べたストリームの状態が先頭付近で一致しないこと
+ * ・参考：旧実装と新実装の 1 回あたりのホスト時間、shuffle_deck 1 回の時間
+ *   （ホストの数字なので実機の速さの比較には使えない。実機は prof_stats[PROF_SHUFFLE] で見る）
+ *
+ *   build/rngbench_bin [回数]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "def.h"
+#include "deck.h"
+#include "rng.h"
+
+static double now_ns_(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* 旧実装（比較用に写したもの） */
+static u32 s_old = 2463534242u;
+
+static u32 old_next_(void){
+  u32 x = s_old;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  s_old = x;
+  return x;
+}
+
+static int old_range_(int lo, int hi){
+  if (hi <= lo) return lo;
+  u32 span = (u32)(hi - lo);
+  return lo + (int)(old_next_() % span);
+}
+
+static void old_shuffle_(u8* a, int n){
+  for (int i = n - 1; i > 0; --i){
+    int j = old_range_(0, i + 1);
+    u8 t = a[i]; a[i] = a[j]; a[j] = t;
+  }
+}
+
+static volatile u32 s_sink;
+
+static int cmp_state_(const void* a, const void* b){
+  return memcmp(a, b, sizeof(RngStream));
+}
+
+/* STREAMS 本を steps 回ずつ進め、すべての状態に重複がないか */
+static int overlap_check_(int streams, int steps){
+  RngStream* all = malloc(sizeof(RngStream) * (size_t)streams * (size_t)steps);
+  if (!all) return -1;
+  size_t k = 0;
+  for (int i = 0; i < streams; ++i){
+    RngStream st;
+    rng_stream_init(&st, 0x5EEDu, RNG_STREAM_USER + (u32)i);
+    for (int j = 0; j < steps; ++j){ all[k++] = st; rng_stream_next(&st); }
+  }
+  qsort(all, k, sizeof(RngStream), cmp_state_);
+  int dup = 0;
+  for (size_t i = 1; i < k; ++i) if (!memcmp(&all[i - 1], &all[i], sizeof(RngStream))) dup++;
+  free(all);
+  return dup;
+}
+
+int main(int argc, char** argv){
+  int reps = (argc > 1) ? atoi(argv[1]) : 10000000;
+  if (reps <= 0) reps = 1;
+  rng_set_seed(1);
+
+  static const u32 spans[] = { 52, 1000, 0xC0000000u };
+  for (int s = 0; s < (int)(sizeof(spans) / sizeof(spans[0])); ++s){
+    u32 span = spans[s];
+    RngStream* st = rng_stream(RNG_STREAM_MAIN);
+    u32 acc = 0;
+    double t0 = now_ns_();
+    for (int r = 0; r < reps; ++r) acc += old_next_() % span;
+    double t_old = now_ns_() - t0;
+    t0 = now_ns_();
+    for (int r = 0; r < reps; ++r) acc += rng_stream_below(st, span);
+    double t_new = now_ns_() - t0;
+    s_sink = acc;
+    printf("span %-10u : old %.2f ns, lemire %.2f ns (host)\n",
+           (unsigned)span, t_old / reps, t_new / reps);
+  }
+
+  u8 deck[MAX_DECK], work[MAX_DECK];
+  int n = build_deck(deck);
+  int shuffles = reps / 100 + 1;
+  double t0 = now_ns_();
+  for (int r = 0; r < shuffles; ++r){ memcpy(work, deck, (size_t)n); old_shuffle_(work, n); }
+  double t_old = now_ns_() - t0;
+  t0 = now_ns_();
+  for (int r = 0; r < shuffles; ++r){ memcpy(work, deck, (size_t)n); shuffle_deck(work, n); }
+  double t_new = now_ns_() - t0;
+  s_sink = work[0];
+  printf("shuffle %d cards : old %.1f ns, new %.1f ns (host)\n", n, t_old / shuffles, t_new / shuffles);
+
+  /* 偏り：span/3 未満の割合 */
+  const u32 big = 0xC0000000u, third = big / 3;
+  int lo_old = 0, lo_new = 0;
+  RngStream* st = rng_stream(RNG_STREAM_MAIN);
+  for (int r = 0; r < reps; ++r){
+    if (old_next_() % big < third) lo_old++;
+    if (rng_stream_below(st, big) < third) lo_new++;
+  }
+  printf("bias span/3      : old %.4f, lemire %.4f (uniform 0.3333)\n",
+         (double)lo_old / reps, (double)lo_new / reps);
+
+  int dup = overlap_check_(8, 1 << 16);
+  printf("stream overlap   : %d duplicate states (8 streams x 65536 steps)\n", dup);
+  return dup ? 1 : 0;
+}
@@ -18,8 +18,9 @@ typedef struct {
     u8  field_is_straight; /* 1=階段, 0=セット */
 } FieldState;
 
-/* AI の打ち手選択（out_cards に u8 のカードID、out_n に枚数） */
-int ai_choose_move_group(const Hand* hand,
+/* AI の打ち手選択（out_cards に u8 のカードID、out_n に枚数）。
+   候補探しのループは make IWRAM=1 なら IWRAM に置いた ARM コードで回す */
+IWRAM_CODE int ai_choose_move_group(const Hand* hand,
                          const FieldState* fs,
                          u8 out_cards[4],
                          u8* out_n);
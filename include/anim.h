@@ -0,0 +1,62 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- カード移動アニメーション（固定小数点トゥイーン） ----
+ * 始点→終点を easing 曲線で補間し、毎フレーム anim_update() の1パスで
+ * 全トゥイーンを進めて OAM（OAM_LAYER_ANIM）に書く。除算はスポーン時の1回だけ。
+ * 進行度は Q16、easing と sin は Q8 のテーブル参照。
+ */
+#define ANIM_MAX 32          /* 同時トゥイーン数（= OBJ アフィン行列数） */
+
+enum {
+    ANIM_EASE_LINEAR = 0,
+    ANIM_EASE_OUT,           /* 減速（1-(1-t)^2） */
+    ANIM_EASE_IN_OUT,        /* smoothstep */
+    ANIM_EASE_COUNT
+};
+
+/* 完了待ちの識別タグ */
+enum {
+    ANIM_TAG_NONE = 0,
+    ANIM_TAG_DEAL,           /* 山札→手札 */
+    ANIM_TAG_PLAY            /* 手札→場 */
+};
+
+#define ANIM_F_SPIN  0x01    /* 移動中に1回転（アフィン OBJ） */
+
+typedef struct {
+    s16 x0, y0;              /* 始点（左上, px） */
+    s16 x1, y1;              /* 終点（左上, px） */
+    u16 attr0;               /* 形状ビット（ATTR0_SHAPE_*） */
+    u16 attr1;               /* サイズビット（ATTR1_SIZE(n)） */
+    u16 attr2;               /* タイル番号＋パレット */
+    u8  w, h;                /* スプライト寸法（回転時の中心合わせ） */
+    u8  frames;              /* 所要フレーム（1..255） */
+    u8  ease;                /* ANIM_EASE_* */
+    u8  tag;                 /* ANIM_TAG_* */
+    s8  user;                /* 任意（プレイヤ番号など） */
+    u8  flags;               /* ANIM_F_* */
+} AnimDesc;
+
+/* 全トゥイーンを破棄 */
+void anim_reset(void);
+
+/* トゥイーン開始。空きが無ければ -1 */
+int  anim_spawn(const AnimDesc* d);
+
+/* 1フレーム進めて OAM に書く（oam_begin_frame() の後に1回だけ呼ぶ） */
+void anim_update(void);
+
+/* 進行中の数（tag=ANIM_TAG_NONE なら全タグ / user<0 なら全 user） */
+int  anim_count(int tag, int user);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* ANIM_H */
@@ -0,0 +1,57 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- EWRAM の作業アリーナ ----
+ * 起動処理の後、scratch（.initdata/.initbss の跡地）から ARENA_BYTES を scratch_alloc で取り、
+ * 寿命ごとの切り出し元にする。個別の解放はない。跡地が ARENA_BYTES に足りない分は
+ * ereader.ld が .initbss の末尾を埋めて確保する（__arena_bytes。値を変えるときは両方）。
+ *   ARENA_TURN  : 1 手のあいだ使うもの（main が手番の変わり目で戻す）。下から積む
+ *   ARENA_FRAME : 1 フレームのあいだ使うもの（main が frame_begin の後で戻す）。上から積む
+ * 両端から積むので、片方を戻してももう片方はそのまま（どちらも O(1)）。
+ * 関数の中だけで使う一時領域は arena_mark / arena_release で囲む（AI の作業配列など）。
+ * 足りなければ（arena_init 前の切り出しも）その場で止める：黙って NULL を返すと呼び出し側の
+ * 代わりの動作（AI ならパス）に紛れて気づけないので。peak と high_water で取り置きの大きさを見直す。
+ */
+#define ARENA_BYTES   (8u * 1024u)
+
+enum {
+  ARENA_TURN,
+  ARENA_FRAME,
+  ARENA_SCOPE_COUNT
+};
+
+typedef u32 ArenaMark;
+
+typedef struct {
+    u32 capacity;                     /* 取り置いたバイト数 */
+    u32 used[ARENA_SCOPE_COUNT];      /* いま切り出しているバイト数 */
+    u32 peak[ARENA_SCOPE_COUNT];      /* used の最大 */
+    u32 high_water;                   /* 両方を合わせた最大 */
+    u32 failures;                     /* 足りずに NULL を返した回数 */
+} ArenaStats;
+
+/* base から bytes を切り出し元にする（4 バイト境界に詰める）。統計も消す。base が NULL なら止める */
+void  arena_init(void* base, u32 bytes);
+
+/* scope から 4 バイト境界で bytes 切り出す。足りなければ止める（戻らない） */
+void* arena_alloc(int scope, u32 bytes);
+
+/* scope の今の位置 / そこまで戻す（mark より後に切り出した分がまとめて戻る） */
+ArenaMark arena_mark(int scope);
+void  arena_release(int scope, ArenaMark mark);
+
+/* scope の切り出しをすべて戻す */
+void  arena_reset(int scope);
+
+void  arena_get_stats(ArenaStats* out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* ARENA_H */
@@ -1,23 +1,28 @@
-//{{BLOCK(bg) 
+//{{BLOCK(bg)
 
 //======================================================================
 //
 //	bg, 256x160@4, 
 //	+ palette 16 entries, not compressed
-//	+ tiles (t|f|p reduced) not compressed
-//	+ regular map (flat), not compressed, 32x20 
-//	Total size: 32 + 832 + 1280 = 2144
+//	+ tiles (t|f|p reduced) lz77 compressed
+//	+ sparse map (fill + spans), 32x20 
+//	Total size: 32 + 188 + 82 = 302 (raw 2144)
 //
 //======================================================================
 
 #ifndef GRIT_BG_H
 #define GRIT_BG_H
 
+/* *LZ は BIOS 互換 LZ77、MapSparse は疎マップ（bgmap.h）。起動時に同名の RAM 配列へ展開する */
 #define bgTilesLen 832
-extern const unsigned int bgTiles[208];
+#define bgTilesLZLen 188
+extern const unsigned int bgTilesLZ[47];
+extern unsigned int bgTiles[208];
 
 #define bgMapLen 1280
-extern const unsigned short bgMap[640];
+#define bgMapSparseLen 82
+extern const unsigned short bgMapSparse[41];
+extern unsigned short bgMap[640];
 
 #define bgPalLen 32
 extern const unsigned short bgPal[16];
@@ -25,4 +30,3 @@ extern const unsigned short bgPal[16];
 #endif // GRIT_BG_H
 
 //}}BLOCK(bg)
-    
\ No newline at end of file
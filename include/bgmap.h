@@ -0,0 +1,70 @@
+#ifndef BGMAP_H
+#define BGMAP_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- BG0 タイルマップのシャドウ ----
+ * ERAPI が読み込んだ背景（BG0）のスクリーンエントリを RAM に持ち、
+ * 変化したエントリのある行だけを dmaq で VBlank に転送する。
+ * 背景画像の後ろの空きキャラにタイルを追加でき、元の絵へは bgmap_restore で戻せる。
+ */
+#define BGMAP_COLS 32         /* スクリーンブロック1枚の幅（エントリ） */
+#define BGMAP_ROWS 20         /* 画面内の行数 */
+
+typedef struct {
+    u32 entry_writes;         /* 値が変わったエントリ数 */
+    u32 entry_skips;          /* 同じ値だったので捨てた書き込み */
+    u32 rows_flushed;         /* 転送した行数 */
+} BgMapStats;
+
+/* ---- 疎マップ ----
+ * 地のエントリで矩形を塗り、地と違うセルだけを行ごとのスパンで持つ u16 列
+ * （scripts/gba_bg_convert.py が出力する。卓の一部を差し替えるパッチも同じ形式）。
+ *   [0] 地のエントリ  [1] 矩形 x | y<<8  [2] 幅 | 高さ<<8（0 なら塗らない）  [3] スパン数 N
+ *   スパン: BGMAP_SPAN(x, y, len, run) に続けて、run なら 1 エントリ（len 個並べる）、でなければ len エントリ
+ * 全面へ展開するときは矩形とスパンの外を 0 にする。後のスパンほど優先。
+ */
+#define BGMAP_SPAN_MAX 32
+#define BGMAP_SPAN(x, y, len, run) \
+    ((u16)((x) | ((y) << 5) | (((len) - 1) << 10) | ((run) ? 0x8000 : 0)))
+
+/* 疎マップを BGMAP_COLS x BGMAP_ROWS の平らなマップへ展開（ERAPI へ渡す用など） */
+void bgmap_sparse_expand(const u16* sparse, u16* out);
+
+/* BG0CNT からキャラ/スクリーンの位置を読み（まだ反映されていなければ ERAPI 既定のキャラ 0 / スクリーン 31）、base_map（BGMAP_COLS x BGMAP_ROWS）でシャドウを初期化。
+   first_free_tile は背景画像の次のキャラ番号 */
+void bgmap_init(const u16* base_map, int first_free_tile);
+/* 同上。元の背景を疎マップで持つ（restore は sparse から引くので平らなマップを残さなくてよい） */
+void bgmap_init_sparse(const u16* sparse, int first_free_tile);
+
+/* 空きキャラに count タイル分を転送予約し、先頭キャラ番号を返す（不足なら -1） */
+int  bgmap_alloc_tiles(const void* tiles, int count);
+/* 同上。tiles のプールから index の順に count タイルを並べて載せる */
+int  bgmap_alloc_tiles_indexed(const void* tiles, const u8* index, int count);
+/* 同上。lz は LZ77 ストリーム（count タイル分）。VBlank 中に VRAM へ直接展開する
+   name は lz77 の記録に使うアセット名 */
+int  bgmap_alloc_tiles_lz(const void* lz, int count, const char* name);
+
+/* エントリを設定（同値なら何もしない） */
+void bgmap_set(int x, int y, u16 entry);
+/* 元の背景のエントリへ戻す */
+void bgmap_restore(int x, int y);
+void bgmap_restore_rect(int x, int y, int w, int h);
+
+/* 疎マップ形式のパッチを書く（矩形を地で塗ってからスパンを置く。外側のセルは触らない）。
+   bgmap_set と同じく同値は捨て、変化した行だけが次の bgmap_commit で転送される */
+void bgmap_apply_sparse(const u16* patch);
+
+/* 変更のあった行を VBlank 転送に積む（1フレーム1回） */
+void bgmap_commit(void);
+
+void bgmap_get_stats(BgMapStats* out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* BGMAP_H */
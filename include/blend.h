@@ -0,0 +1,41 @@
+#ifndef BLEND_H
+#define BLEND_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- 画面合成（BLDCNT / BLDALPHA / BLDY） ----
+ * フェード・卓の減光・半透明 OBJ の濃さをそれぞれ 0..16 の段階で持ち、
+ * blend_update() で目標へ1段ずつ近づけてレジスタ値を組み立てる。
+ * 書き込みは hwstate 経由なので、変化したレジスタだけが書かれる（ランプ中は毎フレーム1本）。
+ *
+ * 優先度：画面フェード ＞ 卓の減光。半透明 OBJ（ATTR0_MODE_BLEND）は常に BG0/背景色と合成。
+ */
+#define BLEND_LEVEL_MAX   16
+#define BLEND_DIM_LEVEL   7     /* 役演出中の卓の暗さ */
+
+/* 全効果なし（フェードも減光もしない / 半透明 OBJ は透明から開始） */
+void blend_init(void);
+
+/* 画面フェード：黒から戻す / 黒へ落とす（frames_per_step フレームで1段） */
+void blend_fade_in(int frames_per_step);
+void blend_fade_out(int frames_per_step);
+int  blend_fade_busy(void);
+
+/* 卓（BG0＋背景色）を暗くする／戻す */
+void blend_set_dim(int on);
+
+/* 半透明 OBJ の濃さの目標（0=透明 .. 16=不透明）と現在値 */
+void blend_set_obj_alpha(int target);
+int  blend_obj_alpha(void);
+
+/* 1フレーム進めてレジスタへ反映（1フレーム1回） */
+void blend_update(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* BLEND_H */
@@ -0,0 +1,30 @@
+//{{BLOCK(card_glyphs)
+
+//======================================================================
+//
+//  card faces as template + 1bpp rank/suit, 223 bytes
+//  Auto-generated by scripts/gba_obj_convert_atlas_regions.py. DO NOT EDIT.
+//
+//======================================================================
+
+#ifndef GRIT_CARD_GLYPHS_H
+#define GRIT_CARD_GLYPHS_H
+
+#define CARDGLYPH_RANK_X 2
+#define CARDGLYPH_RANK_Y 2
+#define CARDGLYPH_RANK_H 7
+#define CARDGLYPH_PIP_Y 10
+#define CARDGLYPH_PIP_H 10
+#define CARDGLYPH_TPL_ROWS 2
+
+/* テンプレート：面の各行（32行）がどの行パターンか。パターン = {左タイル, 右タイル} の 4bpp 1 ワード */
+extern const unsigned char cardGlyphTplRow[32];
+extern const unsigned int  cardGlyphTplWords[2][2];
+/* ランク字形 [1..13 → 0..12]（bit0 = 左端、RANK_X だけ右へずらして置く）とスート [SUIT_*] */
+extern const unsigned char  cardGlyphRank[13][7];
+extern const unsigned short cardGlyphPip[4][10];
+extern const unsigned char  cardGlyphInk[4];
+
+#endif // GRIT_CARD_GLYPHS_H
+
+//}}BLOCK(card_glyphs)
@@ -0,0 +1,30 @@
+#ifndef CARDFACE_H
+#define CARDFACE_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- 手続き的カード表面（make CARD_FACES=proc） ----
+ * 共通テンプレート＋1bpp のランク字形とスート（card_glyphs.c）から、
+ * 16x32 4bpp（OBJ 1D で 8 タイル）の表面を組み立てる。
+ * 展開は dmaq のフィル命令として VBlank 中に VRAM へ直接書くので中間バッファは要らない。
+ * ジョーカーは対象外（アトラスの J を使う）。
+ */
+#define CARDFACE_TILES 8
+
+/* card を展開できるなら 1 */
+int cardface_supported(u8 card);
+
+/* dst（OBJ VRAM のタイル先頭）への展開を dmaq に予約。戻り値はチケット（0=失敗） */
+u16 cardface_push(void* dst, u8 card, int prio);
+
+/* 即時展開（計測・ホスト確認用）。dst は 8 タイル = 64 ワード */
+void cardface_expand(void* dst, u8 card);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* CARDFACE_H */
@@ -27,6 +27,23 @@ typedef signed long long s64;
   #endif
 #endif
 
+/* ---- 配置（ereader.ld / crt0.s） ----
+ * IWRAM_CODE : 0x03000000 の IWRAM（32bit バス・ウェイトなし）に置き、ARM 命令で実行する。
+ *              EWRAM からは BL が届かないので long_call。呼ぶ側から見えるよう宣言にも付ける
+ * IWRAM_DATA : IWRAM に置く初期値付きデータ（起動時に crt0 が写す）
+ * IWRAM_BSS  : IWRAM に置くゼロ初期化データ（crt0 がワード単位でクリア）
+ * ホスト確認用ビルドと IWRAM=0（既定。すべて EWRAM の Thumb）では何もしない。
+ */
+#if defined(HOST_BUILD) || defined(NO_IWRAM)
+  #define IWRAM_CODE
+  #define IWRAM_DATA
+  #define IWRAM_BSS
+#else
+  #define IWRAM_CODE __attribute__((section(".iwram.text"), target("arm"), long_call))
+  #define IWRAM_DATA __attribute__((section(".iwram.data")))
+  #define IWRAM_BSS  __attribute__((section(".iwram_bss")))
+#endif
+
 /* ---- ゲーム定数 ---- */
 #define PLAYERS   4
 #define MAX_HAND  20
@@ -0,0 +1,61 @@
+#ifndef DMAQ_H
+#define DMAQ_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- VBlank 遅延 DMA コマンドキュー ----
+ * VRAM / パレット / OAM への転送はすべてここに積み、VBlank 先頭の dmaq_flush() で実行する。
+ * ・同じ転送先への要求は後勝ちで1本にまとめる（優先度は高い方を残す）
+ * ・1フレームの転送量は予算（バイト）以内。入りきらない分は優先度順に次フレームへ回す
+ * ・src はフラッシュされるまで有効なメモリを指していること（ROM/静的バッファ）
+ */
+enum {
+    DMAQ_PRIO_HIGH   = 0,   /* OAM / パレット（表示の整合に必須） */
+    DMAQ_PRIO_NORMAL = 1,   /* カード表面など */
+    DMAQ_PRIO_LOW    = 2,   /* バナー等、1フレーム遅れても良いもの */
+    DMAQ_PRIO_COUNT
+};
+
+#define DMAQ_MAX_CMDS           48
+#define DMAQ_DEFAULT_BUDGET     4096  /* 1フレームの転送上限（バイト） */
+
+typedef struct {
+    u32 last_bytes;      /* 直近フラッシュで転送したバイト数 */
+    u32 last_cmds;       /* 直近フラッシュで実行したコマンド数 */
+    u32 peak_bytes;      /* 1フレームの最大転送量 */
+    u32 pending;         /* 次フレームへ持ち越したコマンド数 */
+    u32 spilled_frames;  /* 予算超過で持ち越しが発生したフレーム数 */
+    u32 coalesced;       /* 同一転送先として統合した回数 */
+    u32 dropped;         /* キュー満杯で捨てた回数 */
+} DmaqStats;
+
+/* 転送要求（words = 32bit 単位）。戻り値はチケット（0=失敗） */
+u16  dmaq_push(void* dst, const void* src, u32 words, int prio);
+
+/* タイル集め転送：tiles（8x8 4bpp のプール）から index[0..count) の順に
+   dst へ 1 タイル（32B）ずつ連続して並べる。番号が連番の区間は 1 本の DMA にまとめる。
+   index も tiles と同じくフラッシュまで有効なメモリを指すこと */
+u16  dmaq_push_tiles(void* dst, const void* tiles, const u8* index, u32 count, int prio);
+
+/* 任意の書き込み：フラッシュ時に fill(dst, src, aux, words) を呼ぶ（圧縮データの展開など）。
+   予算には words*4 バイトとして数える。同じ dst の統合規則は dmaq_push と同じ */
+typedef void (*DmaqFillFn)(void* dst, const void* src, const void* aux, u32 words);
+u16  dmaq_push_fill(void* dst, DmaqFillFn fill, const void* src, const void* aux, u32 words, int prio);
+
+/* チケットの転送がまだ終わっていなければ 1 */
+int  dmaq_is_pending(u16 ticket);
+
+/* VBlank 先頭で呼ぶ。予算内で優先度順に実行し、転送バイト数を返す */
+u32  dmaq_flush(void);
+
+void dmaq_set_budget(u32 bytes);
+void dmaq_get_stats(DmaqStats* out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* DMAQ_H */
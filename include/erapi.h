@@ -62,6 +62,10 @@ struct _ERAPI_BACKGROUND
 };
 
 //#define ERAPI_STUB
+#ifdef HOST_BUILD
+#  define ERAPI_STUB
+#  include "host_erapi.h"   /* ホスト確認用：描画に関わる呼び出しだけ真似る */
+#endif
 
 #ifndef ERAPI_STUB
 #define ERAPI_Div(a,b)                                    ERAPI_FUNC_X3( 0x103, a, b)
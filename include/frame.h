@@ -0,0 +1,56 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- フレームスケジューラ（VBlank 割り込みで反映・ERAPI_RenderFrame で待つ） ----
+ * VBlank 割り込みの先頭で、メインループが「確定」したフレームのレジスタ（hw_state_commit）と
+ * dmaq（VRAM/パレット/OAM）を反映する。反映はいつも VBlank の同じ位置から始まり、
+ * メインループの処理時間に左右されない。
+ * メインループは処理を終えたら frame_end で確定し、これまでどおり ERAPI_RenderFrame(1) で 1 フレーム待つ。
+ * ファームウェアの割り込みハンドラは入口の後ろにつないで呼ぶ。
+ *
+ *   for (;;){
+ *     int steps = frame_begin();           // 前回から経った VBlank 数（固定ステップの回数）
+ *     for (i < steps) ロジックを 1 ステップ
+ *     描画（dmaq に積む）
+ *     frame_end();                         // 確定 → 次の VBlank で転送 → 起きる
+ *   }
+ *
+ * ロジックが 1 フレームに収まらないと、その間の VBlank は反映なしで過ぎる（落ちたフレーム）。
+ * 次の frame_begin がその数だけロジックを進めて（最大 FRAME_MAX_STEPS）時間の進みを保つ。
+ */
+#define FRAME_MAX_STEPS   3     /* 1 回の frame_begin で追いつくロジックのステップ数の上限 */
+
+typedef struct {
+    u32 vblanks;      /* 割り込みを受けた VBlank の数 */
+    u32 frames;       /* frame_end の回数（描画したフレーム） */
+    u32 dropped;      /* 転送なしで過ぎた VBlank の数（ロジックの超過） */
+    u32 late;         /* 超過が起きたフレームの数 */
+    u32 busy_last;    /* 直近フレームの frame_begin → frame_end（サイクル） */
+    u32 busy_peak;    /* その最大 */
+} FrameStats;
+
+/* VBlank 割り込みを入れる（prof_init の後、最初の frame_begin の前に1回） */
+void frame_init(void);
+/* 元の割り込みハンドラと IE に戻す（ファームウェアへ戻る前に） */
+void frame_shutdown(void);
+
+/* ロジックのステップ数（1..FRAME_MAX_STEPS）を返す */
+int  frame_begin(void);
+/* このフレームの描画を確定し、ERAPI_RenderFrame(1) で次の VBlank の反映が済むまで待つ */
+void frame_end(void);
+
+/* 確定とは関係なく次の VBlank の開始まで眠る（起動時の VRAM 初期化など） */
+void frame_wait_vblank(void);
+
+void frame_get_stats(FrameStats* out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* FRAME_H */
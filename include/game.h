@@ -8,7 +8,10 @@ extern "C" {
 #endif
 
 /* ---- 演出テンポ ---- */
-#define DEAL_DELAY_FRAMES   4    /* 配りの待機フレーム */
+#define DEAL_ANIM_FRAMES    12   /* 配り1枚の移動フレーム（anim） */
+#define DEAL_IN_FLIGHT_MAX  3    /* 同時に飛ばす配り札の上限（これで配りの間隔が決まる） */
+#define DEAL_STAGGER_FRAMES 1    /* 連続して配るときの最小間隔 */
+#define PLAY_ANIM_FRAMES    16   /* 出した札が場に着くまでのフレーム */
 #define TURN_DELAY_FRAMES   50   /* ターン間ディレイ */
 
 /* ---- 効果種別（render.c が effect に応じてスプライトを選ぶ） ----
@@ -38,7 +41,8 @@ typedef struct GameState {
     int target [PLAYERS];
     int deal_turn;
     int deal_delay;
-    int deal_done;
+    int deal_done;     /* 全札が配られ、配り演出も着地済み */
+    int deal_last;     /* 直前に配った相手（game_step_deal が 1 を返したとき有効） */
 
     /* ターン進行 */
     int turn_player;   /* 0=自分, 1..3=CPU */
@@ -51,6 +55,7 @@ typedef struct GameState {
     u8   field_count;            /* セット枚数/階段長 */
     u8   field_eff_rank;         /* 有効ランク（革命⊕Jバック反転後） */
     const char* field_names[4];  /* 表示用カード名（最大4枚） */
+    u8   field_cards[4];         /* 場のカードID（描画用） */
     u8   field_suit_mask;        /* 場のスート集合 bit0..3 */
     u8   field_is_straight;      /* 階段フラグ */
     u8   sibari_active;          /* しばり成立中 */
@@ -68,9 +73,12 @@ typedef struct GameState {
 
 /* 初期化/配布/進行 */
 void game_init(GameState* g, const Hand hands[PLAYERS], int start_player_for_deal);
-int  game_step_deal(GameState* g);
+int  game_step_deal(GameState* g);   /* 1枚配ったら 1（配り先は deal_last） */
 int  game_step_turn(GameState* g, Hand hands[PLAYERS]);
 
+/* card が今の場に乗りうるか（1枚単位の目安。手札の強調/減光に使う） */
+int  game_card_can_follow(const GameState* g, u8 card);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,26 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include "def.h"
+#include "game.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- HUD（BG0 のマップに直接置く） ----
+ * CPU の残り枚数・手番マーカー・革命/11バック/しばりのアイコン。
+ * いま表示している値を覚えておき、変わった項目のセルだけ bgmap に書く
+ * （何も変わらないフレームは比較だけで終わる）。
+ */
+
+/* タイル転送とパレット読み込み（render_init_vram の後に一度） */
+void hud_init(void);
+
+/* g の内容と表示を突き合わせ、変わったセルだけ書き換える（1フレーム1回） */
+void hud_update(const GameState* g);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* HUD_H */
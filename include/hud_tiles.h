@@ -0,0 +1,37 @@
+//{{BLOCK(hud_tiles)
+
+//======================================================================
+//
+//  HUD tiles, 8x8@4, 14 tiles (scripts/gba_hud_tiles.py)
+//
+//======================================================================
+
+#ifndef GRIT_HUD_TILES_H
+#define GRIT_HUD_TILES_H
+
+#define HUD_TILE_DIGIT_0 0
+#define HUD_TILE_DIGIT_1 1
+#define HUD_TILE_DIGIT_2 2
+#define HUD_TILE_DIGIT_3 3
+#define HUD_TILE_DIGIT_4 4
+#define HUD_TILE_DIGIT_5 5
+#define HUD_TILE_DIGIT_6 6
+#define HUD_TILE_DIGIT_7 7
+#define HUD_TILE_DIGIT_8 8
+#define HUD_TILE_DIGIT_9 9
+#define HUD_TILE_TURN 10
+#define HUD_TILE_REV 11
+#define HUD_TILE_JBACK 12
+#define HUD_TILE_SIBARI 13
+#define HUD_TILE_COUNT 14
+
+#define hud_tilesTilesLen 448
+#define hud_tilesTilesLZLen 236
+extern const unsigned int hud_tilesTilesLZ[59];
+
+#define hud_tilesPalLen 32
+extern const unsigned short hud_tilesPal[16];
+
+#endif // GRIT_HUD_TILES_H
+
+//}}BLOCK(hud_tiles)
@@ -0,0 +1,49 @@
+#ifndef HWSTATE_H
+#define HWSTATE_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- 描画ステートキャッシュ ----
+ * DISPCNT / LCD系レジスタ / BG・OBJ パレット各バンクの「いま載っている値」を保持し、
+ * 要求値と異なるときだけハードウェアへ書き込む。
+ * 書き込みはどれも VBlank まで待たせる（描画中に変わって画面が裂けないように）：
+ * レジスタは hw_state_commit、パレットは dmaq で反映する。frame.c の VBlank 割り込みが両方を呼ぶ。
+ * ERAPI 側が同じ資源を書き換えた後は hw_state_invalidate() で捨てること。
+ */
+
+/* 統計（抑止した書き込み / 実際の書き込み） */
+typedef struct {
+    u32 reg_writes;     /* レジスタ実書き込み回数 */
+    u32 reg_skips;      /* 同値のため抑止した回数 */
+    u32 pal_writes;     /* パレットバンク転送回数（1バンク=32B） */
+    u32 pal_skips;      /* 同内容のため抑止した回数 */
+} HwStateStats;
+
+/* キャッシュを全て無効化（次の要求は必ず書き込まれる） */
+void hw_state_invalidate(void);
+
+/* DISPCNT：clear_mask のビットを落として set_bits を立てた値にする */
+void hw_dispcnt_update(u16 clear_mask, u16 set_bits);
+
+/* LCD系 16bit レジスタ（REG_OFS_*）への書き込み（同値なら抑止）。範囲外はその場で書く */
+void hw_reg16_set(u32 ofs, u16 val);
+
+/* 待たせているレジスタ書き込みを反映する（VBlank の先頭で。dmaq_flush と同じ所） */
+void hw_state_commit(void);
+
+/* パレット 16色（1バンク）をロード（同内容なら抑止） */
+void hw_obj_pal_load(int bank, const u16 pal[16]);
+void hw_bg_pal_load (int bank, const u16 pal[16]);
+
+/* 統計の取得／クリア */
+void hw_state_get_stats(HwStateStats* out);
+void hw_state_clear_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* HWSTATE_H */
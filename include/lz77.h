@@ -0,0 +1,52 @@
+#ifndef LZ77_H
+#define LZ77_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- BIOS 互換 LZ77 の展開（scripts/gba_lz77.py で圧縮した資産） ----
+ * ストリーム先頭の u32 = 0x10 | (展開後サイズ << 8)。
+ * WRAM 版は SWI 0x11（LZ77UnCompWram）、VRAM 版は SWI 0x12（LZ77UnCompVram）。
+ * VRAM 版は 16bit 単位で書くので、距離 1 の参照を含まないストリーム（既定の圧縮）を渡すこと。
+ * 展開ごとにサイクル数を測り（prof の PROF_LZ77 枠）、アセット名ごとの記録と合計を残す。
+ */
+typedef struct {
+    u32 calls;          /* 展開回数 */
+    u32 packed_bytes;   /* 圧縮ストリームの合計 */
+    u32 raw_bytes;      /* 展開後の合計 */
+    u32 cycles;         /* 展開にかかったサイクル数の合計（16.78MHz） */
+} Lz77Stats;
+
+/* アセット 1 つ分の記録（同じ名前で何度か展開したら積算する） */
+#define LZ77_MAX_RECORDS 8
+typedef struct {
+    const char* name;   /* 展開時に渡した名前（NULL は "?"） */
+    u32 calls;
+    u32 packed_bytes;
+    u32 raw_bytes;
+    u32 cycles;
+} Lz77Record;
+
+/* 展開後のバイト数（ヘッダから） */
+u32  lz77_raw_size(const void* src);
+
+/* dst（RAM）へ展開。dst は lz77_raw_size(src) バイト以上。name は記録用のアセット名 */
+void lz77_unpack_wram(const void* src, void* dst, const char* name);
+
+/* dst（VRAM）へ展開 */
+void lz77_unpack_vram(const void* src, void* dst, const char* name);
+
+/* dmaq_push_fill 用：VBlank 中に src を dst（VRAM）へ展開する（aux はアセット名、words は未使用） */
+void lz77_fill_vram(void* dst, const void* src, const void* aux, u32 words);
+
+void lz77_get_stats(Lz77Stats* out);
+/* アセットごとの記録（最初に展開した順）。件数を返し、*out に先頭を入れる */
+int  lz77_get_records(const Lz77Record** out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* LZ77_H */
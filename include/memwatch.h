@@ -0,0 +1,62 @@
+#ifndef MEMWATCH_H
+#define MEMWATCH_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- スタック／アリーナの使用量（デバッグビルド：make MEMWATCH=1） ----
+ * memwatch_init を呼んだ時の sp の下 MEMWATCH_STACK_BYTES（ERAPI の作業域と __iwram_bss_end より上に
+ * 切り詰める）とアリーナを MEMW_CANARY で塗り、塗りが消えた深さから実際に使った量を出す。
+ * 窓の底まで消えていたら overflow に数える（窓を広げて測り直す）。
+ * スタックは区間（フェーズ）ごと：memwatch_mark(phase) が前回の印からの最深を phase に積み、
+ * 使われた部分を塗り直す。アリーナは起動からの延べ（一度でも書いたワード数）。
+ * 結果は memwatch（先頭が MEMW_MAGIC。アドレスはマップファイル）をエミュレータのメモリビューアで読む。
+ * MEMWATCH を定義しないビルドでは呼び出しごと消える。
+ */
+#define MEMW_MAGIC   0x574D454Du    /* "MEMW" */
+#define MEMW_CANARY  0xC0DEFACEu
+#ifndef MEMWATCH_STACK_BYTES
+#define MEMWATCH_STACK_BYTES 1024u    /* スタックを塗る窓の大きさ */
+#endif
+
+enum {
+  MEMW_DEAL,        /* 配り（game_step_deal と配りアニメ） */
+  MEMW_CPU_TURN,    /* 手番の進行（CPU の思考を含む） */
+  MEMW_EFFECTS,     /* SE/BGM・役バナー */
+  MEMW_RENDER,      /* 手札の状態・HUD・サウンド更新・render_frame */
+  MEMW_VBLANK,      /* frame_end の待ち（VBlank 割り込みの hw_state_commit・dmaq_flush） */
+  MEMW_PHASE_COUNT
+};
+
+typedef struct {
+    u32 magic;
+    u32 stack_top;                     /* 塗り始めた時の sp */
+    u32 stack_limit;                   /* 塗った窓の底 */
+    u32 stack_peak[MEMW_PHASE_COUNT];  /* stack_top から最深までのバイト数 */
+    u32 stack_peak_all;
+    u32 stack_free;                    /* 最深から stack_limit までの残り */
+    u32 overflow;                      /* 底の塗りまで消えていた回数（あふれの疑い） */
+    u32 heap_base;
+    u32 heap_bytes;
+    u32 heap_touched;                  /* アリーナのうち書かれたことのあるバイト数 */
+} MemWatch;
+
+#ifdef MEMWATCH
+extern MemWatch memwatch;
+
+/* 塗る（main がアリーナを取った直後に1回）。heap は塗るだけで中身は壊してよい範囲 */
+void memwatch_init(void* heap, u32 heap_bytes);
+/* 前回の印からのスタックの最深を phase に積む。MEMW_VBLANK ではアリーナも数える */
+void memwatch_mark(int phase);
+#else
+#define memwatch_init(heap, bytes)  ((void)0)
+#define memwatch_mark(phase)        ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* MEMWATCH_H */
@@ -0,0 +1,33 @@
+//{{BLOCK(msg_glyphs)
+
+//======================================================================
+//
+//  message glyphs, 8x8@4, 24 chars -> 24 tiles (scripts/msg2h.py)
+//  Auto-generated from text/messages_jpn.txt. DO NOT EDIT.
+//
+//======================================================================
+
+#ifndef GRIT_MSG_GLYPHS_H
+#define GRIT_MSG_GLYPHS_H
+
+#define msg_glyphsTileCount 24
+#define msg_glyphsTilesLen 768
+#define msg_glyphsTilesLZLen 424
+extern const unsigned int msg_glyphsTilesLZ[106];
+
+/* メッセージ：{幅タイル, 高さタイル, タイル番号(行優先)...}。0 は透明タイル */
+extern const unsigned short MSGT_CARD[3];
+extern const unsigned short MSGT_CLEAR[3];
+extern const unsigned short MSGT_MARK[3];
+extern const unsigned short MSGT_TIME_LABEL[7];
+extern const unsigned short MSGT_TARGET_LABEL[8];
+extern const unsigned short MSGT_TARGET_TIMER[6];
+extern const unsigned short MSGT_TARGET_MUSIC[6];
+extern const unsigned short MSGT_TARGET_BG[6];
+extern const unsigned short MSGT_MUSIC_LABEL[7];
+extern const unsigned short MSGT_BG_LABEL[7];
+extern const unsigned short MSGT_BG_SEP[3];
+
+#endif // GRIT_MSG_GLYPHS_H
+
+//}}BLOCK(msg_glyphs)
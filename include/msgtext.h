@@ -0,0 +1,32 @@
+#ifndef MSGTEXT_H
+#define MSGTEXT_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- 事前描画済みメッセージの表示（BG0 マップへのコピー） ----
+ * make assets が text/messages_jpn.txt と assets/msg_font8.txt から msg_glyphs.c/.h を作る
+ * （scripts/msg2h.py --font）。使う文字だけのグリフタイル（LZ77）と、メッセージごとの
+ * タイル番号列 MSGT_<KEY>（{幅タイル, 高さタイル, タイル番号...}）をそのまま使う。
+ * 実行時の文字描画（ERAPI_DrawText）は行わない。
+ * グリフの色番号は HUD と同じ（1=文字 2=影）なので、パレットは hud_tilesPal を渡せばよい。
+ */
+
+/* グリフタイル（msg_glyphsTilesLZ / msg_glyphsTileCount）を BG キャラへ展開予約し、
+   pal をバンク pal_bank に載せる（pal=NULL なら既存のバンクを使う）。
+   タイルは .initdata なので起動処理の中（scratch_reclaim_init の前）で呼ぶ */
+int  msgtext_load(const void* tiles_lz, int tile_count, const u16* pal, int pal_bank);
+
+/* セル (x,y) を左上にメッセージを置く。タイル0（透明）は背景のまま */
+void msgtext_draw(int x, int y, const u16* msg);
+
+/* msgtext_draw で置いた範囲を元の背景に戻す */
+void msgtext_clear(int x, int y, const u16* msg);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* MSGTEXT_H */
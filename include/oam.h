@@ -0,0 +1,52 @@
+#ifndef OAM_H
+#define OAM_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- OAM アロケータ ----
+ * 描画側はレイヤーごとに OAM を確保して attr0..2 を書くだけ。
+ * oam_commit() で手前のレイヤーから順に詰めてシャドウを組み、dmaq で VBlank に転送する。
+ * （GBA は同じ優先度なら OAM 番号が小さいほど手前）
+ * 各レイヤーには上限があり、合計は必ず 128 以内に収まる。
+ */
+enum {
+    OAM_LAYER_CURSOR = 0,   /* 最前面 */
+    OAM_LAYER_BANNER,
+    OAM_LAYER_ANIM,         /* 移動中のカード（anim） */
+    OAM_LAYER_HAND,
+    OAM_LAYER_FIELD,        /* 最背面（CPU の裏面は BG 側） */
+    OAM_LAYER_COUNT
+};
+
+#define OAM_ENTRIES 128
+
+typedef struct {
+    u16 used;                        /* 今フレームの使用数 */
+    u16 peak;                        /* 最大使用数 */
+    u16 dropped;                     /* 今フレーム上限超過で描けなかった数 */
+    u16 layer_used[OAM_LAYER_COUNT]; /* レイヤー別の使用数 */
+} OamStats;
+
+/* フレームの組み立て開始（全レイヤーを空にする） */
+void oam_begin_frame(void);
+
+/* layer から1エントリ確保し attr0..2 の書き込み先を返す（上限超過なら NULL） */
+u16* oam_alloc(int layer);
+
+/* 手前のレイヤーから詰めて OAM シャドウを作り、VBlank 転送を予約する */
+IWRAM_CODE void oam_commit(void);
+
+/* アフィン行列 m（0..31）を設定（attr3 に散らばる pa,pb,pc,pd。8.8 固定小数点）
+ * 今フレームで設定した行列は oam_commit() の転送範囲に含まれる */
+void oam_set_affine(int m, s16 pa, s16 pb, s16 pc, s16 pd);
+
+void oam_get_stats(OamStats* out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* OAM_H */
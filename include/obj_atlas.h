@@ -12,17 +12,45 @@ typedef struct {
   unsigned short w, h;
   unsigned short tiles_per_frame;
   unsigned short frames;
-  unsigned int   offset_words;
+  unsigned short index_first;  /* objAtlasTileIndex の先頭（tiles_per_frame 個） */
   unsigned char  width_code;
   unsigned char  height_code;
+  unsigned short piece_first;  /* objAtlasPieces の先頭 */
+  unsigned short piece_count;  /* OBJ 何枚で描くか */
 } ObjSpriteDesc;
 
-#define obj_atlasTilesLen 16224
-extern const unsigned int obj_atlasTiles[4056];
+/* OAM テンプレート：attr0/attr1 の形状・サイズビットと、スプライト先頭からの
+   タイルオフセット・表示オフセット。タイル番号列はこの順に 1D で並べてある */
+typedef struct {
+  unsigned short attr0;   /* shape */
+  unsigned short attr1;   /* size */
+  unsigned short tile;
+  unsigned char  dx, dy;
+} ObjOamPiece;
+
+/* 重複除去済みのタイルプール。スプライトの VRAM 像は
+   objAtlasTileIndex[index_first..] の順にタイルを並べたもの。
+   obj_atlasTilesLZ（BIOS 互換 LZ77）を起動時に obj_atlasTiles へ展開して使う */
+#define obj_atlasTileCount 145
+#define obj_atlasTilesLen 4640
+#define obj_atlasTilesLZLen 1212
+extern const unsigned int obj_atlasTilesLZ[303];
+extern unsigned int obj_atlasTiles[1160];
+#define obj_atlasTileIndexLen 507
+extern const unsigned char objAtlasTileIndex[507];
 #define obj_atlasPalLen 32
 extern const unsigned short obj_atlasPal[16];
 
+/* パレット派生：バンク番号 = 派生番号で一度だけ読み込み、attr2 のバンクで切り替える */
+#define OBJ_PAL_NORMAL 0
+#define OBJ_PAL_DIMMED 1
+#define OBJ_PAL_HIGHLIGHT 2
+#define OBJ_PAL_SELECTED 3
+#define OBJ_PAL_VARIANTS 4
+extern const unsigned short obj_atlasPalVariants[4][16];
+
 extern const ObjSpriteDesc objAtlasSprites[62];
+extern const ObjOamPiece objAtlasPieces[68];
 extern const char* objAtlasNames[62];
 #define OBJ_ATLAS_SPRITE_COUNT 62
 
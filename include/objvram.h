@@ -0,0 +1,43 @@
+#ifndef OBJVRAM_H
+#define OBJVRAM_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- OBJ VRAM 常駐管理（カード表面 16x32 = 8タイル） ----
+ * カードID ごとに VRAM スロットを割り当て、一度載せたタイルは動かさない。
+ * 手札の並び替えや場の表示は OAM のタイル番号を変えるだけで済む。
+ * 空きが無いときだけ LRU（最後に使ったフレームが最も古いスロット）を追い出す。
+ * 同じフレーム内で使用済みのスロットは追い出さない。
+ */
+#define OBJVRAM_FACE_TILES   8    /* 16x32 4bpp */
+#define OBJVRAM_FACE_SLOTS   24   /* 手札 MAX_HAND(20) + 場 4 */
+
+typedef struct {
+    u32 uploads;     /* VRAM 転送回数（1回=256B） */
+    u32 hits;        /* 既に常駐していた回数 */
+    u32 evictions;   /* LRU 追い出し回数 */
+} ObjVramStats;
+
+/* tile_base から slot_count 枚ぶんのタイル領域を常駐プールとして使う */
+void objvram_init(int tile_base, int slot_count);
+
+/* フレーム開始（LRU の時刻を進める） */
+void objvram_begin_frame(void);
+
+/* card の表面タイル先頭を返す（未常駐なら dmaq に転送を予約）。
+   転送が VBlank で反映されるまでは -1 を返すので、そのフレームは描かないこと */
+int  objvram_face_acquire(u8 card);
+
+/* プールが占めるタイル数 */
+int  objvram_tiles_used(void);
+
+void objvram_get_stats(ObjVramStats* out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* OBJVRAM_H */
@@ -0,0 +1,44 @@
+#ifndef PROF_H
+#define PROF_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- 処理時間の計測 ----
+ * タイマー 2/3 をカスケードで回しっぱなしにし、32bit のサイクル数（16.78MHz）として読む。
+ * 区間の長さを枠（PROF_*）ごとに積算する：呼び出し回数・合計・最大。
+ * 結果は prof_stats（アドレスはマップファイル）をエミュレータのメモリビューアで読むか prof_get で取る。
+ * 既定のビルド（IWRAM=0、すべて EWRAM の Thumb）と IWRAM=1 のビルドで並べると IWRAM/ARM 化の効果が分かる。
+ */
+enum {
+  PROF_AI,        /* ai_choose_move_group（1 手の思考） */
+  PROF_OAM,       /* oam_commit（OAM シャドウの組み立て） */
+  PROF_SHUFFLE,   /* shuffle_deck（配り前の並べ替え 1 回） */
+  PROF_FLUSH,     /* VBlank 割り込み内の dmaq_flush（frame） */
+  PROF_LZ77,      /* LZ77 の展開（起動時のアセット。1 ストリーム = 1 回） */
+  PROF_COUNT
+};
+
+typedef struct {
+    u32 calls;
+    u32 cycles;     /* 合計 */
+    u32 max;        /* 1 回の最大 */
+} ProfStat;
+
+extern ProfStat prof_stats[PROF_COUNT];
+
+/* タイマーを 0 から回し始め、統計を消す（起動時に1回） */
+void prof_init(void);
+/* 現在のサイクル数 */
+u32  prof_now(void);
+/* t0（prof_now の値）から今までを slot に積む */
+void prof_add(int slot, u32 t0);
+void prof_get(int slot, ProfStat* out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* PROF_H */
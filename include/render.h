@@ -12,33 +12,32 @@ extern "C" {
 /*ゲーム画面（背景やUI）を初期化 */
 void render_init_ui(void); 
 
-/* 初期VRAMロード（VBlank中に呼ぶ） */
-void render_init_vram(const Hand* me,
-                      int max_player_show,
-                      int out_face_tile_base[12],
-                      int* out_back_tile_base,
-                      int* out_field_tile_base /* 互換のため残すが未使用可 */);
-
-/* （互換）場カード1枚の絵をVRAMに上書き（16x32=8タイル）
-   ※ 複数枚対応後は render_set_field_cards() を推奨 */
-void render_upload_field_card(const char* name, int field_tile_base);
-
-/* 場のカード群（表）をVRAMにロード（最大4枚） */
-void render_set_field_cards(const char* const names[4], int count);
-
-/* 毎フレームのOAM更新（ERAPI_RenderFrame(1)直後に必ず呼ぶこと）
-   新API：場は field_visible / field_count のみ渡す（内部にロード済み配列あり） */
-void render_frame(const int g_visible[PLAYERS],
-                  const int player_face_tile_base[12],
-                  int back_tile_base,
+/* 初期VRAMロード（VBlank中に呼ぶ）
+   カード表面は objvram の常駐プールに載る。手札はここで先読みする */
+void render_init_vram(const Hand* me, int* out_back_tile_base);
+
+/* 場のカード群（表）を設定（最大4枚）。常駐済みのカードは転送しない */
+void render_set_field_cards(const u8 cards[4], int count);
+
+/* カードの表示状態（OBJ_PAL_NORMAL/DIMMED/HIGHLIGHT/SELECTED）。
+   派生パレットは常駐しているので、変わるのは attr2 のバンクだけ（VRAM 転送なし） */
+void render_set_card_pal(u8 card, int variant);
+
+/* カード移動演出（anim）：配りは山札→手札、出しは出し手→場。
+   到着までは通常の手札・場の描画から外れる */
+void render_anim_deal(int player, int index, u8 card);
+/* before は出す前の出し手の手札（自分の札は、並んでいたスロットから飛ぶ） */
+void render_anim_play(int player, const u8 cards[4], int count, const Hand* before);
+
+/* 毎フレームのOAM組み立て（結果は dmaq で次の VBlank に転送される）
+   手札は me の並びのまま表示する。並びが変わってもタイルは動かさず、
+   OAM のタイル番号だけが変わる。MAX_HAND 枚まで重ねて画面内に収める。
+   CPU の裏面は OAM を使わず BG0 のマップに並べる（枚数が変わったときだけ更新） */
+void render_frame(const Hand* me,
+                  const int g_visible[PLAYERS],
                   int field_visible,
                   int field_count);
 
-/* 自分の手札が減った/並びが変わったときに表を再転送（最大12） */
-void render_reload_hand_card(const Hand* me,
-                             int player_face_tile_base[12],
-                             int start_tile_base /*通常0*/);
-
 /* 8切りの表示要求（待機中だけON）— 見た目の優先度は「しばり ＞ 8切り」 */
 void render_set_yagiri_visible(int on);
 
@@ -46,9 +45,6 @@ void render_set_yagiri_visible(int on);
    8切りの表示要求より“見た目上”優先。 */
 void render_trigger_sibari(int frames);
 
-/* 互換API: 旧名を新実装へフォワード（旧 main.c 対応） */
-void render_upload_field_cards(const char** names, int count);
-
 void render_effect_enqueue(int effect, int frames);
 
 int  render_is_effect_active(void);
@@ -3,13 +3,51 @@
 
 #include "def.h"
 
-/* --- ランダム待機からシード生成 --- */
-void rng_seed(int min_frames, int max_frames);
+/* --- シード ---
+ * 待ち時間は作らない。起動時の揺らぎ（走査線の位相・VCOUNT・起動からのサイクル数・TM0）から
+ * rng_seed_auto がシードを決めて乱数状態に入れる（配りは起動直後なので、キー入力は使わない）。
+ * 同じシードを rng_set_seed に渡せば同じ並びが出る（再現用）。rng_get_seed は今のシード。
+ * シード 0 は既定の状態（何も設定しないときと同じ）。
+ */
+u32  rng_seed_auto(void);
+void rng_set_seed(u32 seed);
+u32  rng_get_seed(void);
 
-/* --- 32bit 乱数を返す（xorshift32）--- */
+/* --- ストリーム（xoshiro128**、周期 2^128-1）---
+ * 同じシードから番号ごとに 2^64 ずつ先へ飛ばした位置で始めるので、2^64 回引くまでは重ならない。
+ * 組み込みのストリームは rng_set_seed / rng_seed_auto でまとめて作り直す：
+ *   RNG_STREAM_MAIN : rng_next / rng_range（配り・シャッフル）
+ *   RNG_STREAM_AI   : AI のサンプリング用（rng_stream(RNG_STREAM_AI)）
+ * ホストの並列シミュレーションなどは RNG_STREAM_USER + ワーカー番号で rng_stream_init する。
+ */
+typedef struct {
+    u32 s[4];
+} RngStream;
+
+enum {
+    RNG_STREAM_MAIN,
+    RNG_STREAM_AI,
+    RNG_STREAM_COUNT,
+    RNG_STREAM_USER = RNG_STREAM_COUNT
+};
+
+/* seed から作り、index 回 2^64 先へ飛ばす */
+void rng_stream_init(RngStream* st, u32 seed, u32 index);
+/* 2^64 回分先へ飛ばす（128 ステップ分の計算） */
+void rng_stream_jump(RngStream* st);
+u32  rng_stream_next(RngStream* st);
+/* [0, span) の一様乱数。掛け算と上位 32bit で求め、端数に当たったら引き直す（Lemire の方法）。
+   剰余で取ると span が 2^32 に近いほど小さい値に偏る（rngbench の span/3 で 0.50、こちらは 0.3331）。
+   span == 0 なら 0 */
+IWRAM_CODE u32 rng_stream_below(RngStream* st, u32 span);
+
+/* 組み込みのストリーム（id は RNG_STREAM_MAIN / RNG_STREAM_AI） */
+RngStream* rng_stream(int id);
+
+/* --- 32bit 乱数を返す（RNG_STREAM_MAIN）--- */
 u32  rng_next(void);
 
-/* --- (lo, hi) の半開区間で一様乱数を返す（hi <= lo の場合は lo を返す）--- */
+/* --- (lo, hi) の半開区間で一様乱数を返す（hi <= lo の場合は lo を返す。偏りなし）--- */
 int  rng_range(int lo, int hi);
 
 
@@ -0,0 +1,42 @@
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+#include "def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ---- 起動時だけのデータと、その跡地の作業領域 ----
+ * VRAM へ上げたら用済みになる配列（LZ77 ストリーム・展開バッファ・ERAPI に渡した BG）は
+ * INIT_RODATA / INIT_BSS で .initdata / .initbss に置く。ereader.ld がイメージ末尾
+ * （.data の後、.bss の前。IWRAM へ写し終えた .iwram のロード像も含む）に並べ、
+ * 範囲と大きさ（__init_size / __init_kb）をマップに出す。
+ * 起動処理の最後（最初の dmaq_flush の後）に scratch_reclaim_init() を呼ぶと、
+ * その範囲が scratch_alloc の切り出し元になる。個別の解放はなく scratch_reset で全部戻す。
+ * main はここから arena（arena.h）を取る。ホストビルドでは代わりに静的配列を使う。
+ */
+#define INIT_RODATA __attribute__((section(".initdata")))
+#define INIT_BSS    __attribute__((section(".initbss")))
+
+typedef struct {
+    u32 capacity;     /* 回収したバイト数 */
+    u32 used;         /* いま切り出しているバイト数 */
+    u32 peak;         /* used の最大 */
+    u32 failures;     /* 足りずに NULL を返した回数 */
+} ScratchStats;
+
+/* .initdata/.initbss の範囲を作業領域にする（以後それらの配列は読まないこと） */
+void  scratch_reclaim_init(void);
+
+/* 4 バイト境界で bytes 切り出す。足りなければ NULL */
+void* scratch_alloc(u32 bytes);
+/* 切り出しをすべて戻す */
+void  scratch_reset(void);
+
+void  scratch_get_stats(ScratchStats* out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* SCRATCH_H */
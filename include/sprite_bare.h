@@ -2,14 +2,28 @@
 #define SPRITE_BARE_H
 
 #include <stdint.h>
-#define REG_DISPCNT   (*(volatile uint16_t*)0x04000000)
+
+// メモリ領域の先頭（HOST_BUILD ではホスト側の配列に差し替えて render 等をそのまま動かす）
+#ifdef HOST_BUILD
+#  include "hostmem.h"
+#  define GBA_IO_BASE    ((uintptr_t)host_io)
+#  define GBA_PAL_BASE   ((uintptr_t)host_pal)
+#  define GBA_VRAM_BASE  ((uintptr_t)host_vram)
+#  define GBA_OAM_BASE   ((uintptr_t)host_oam)
+#else
+#  define GBA_IO_BASE    0x04000000u
+#  define GBA_PAL_BASE   0x05000000u
+#  define GBA_VRAM_BASE  0x06000000u
+#  define GBA_OAM_BASE   0x07000000u
+#endif
+
+#define REG_DISPCNT   (*(volatile uint16_t*)(GBA_IO_BASE + 0x0000))
 // --- OBJ 関連ビット ---
 #define OBJ_ENABLE    0x1000  // OBJ表示を有効化
 #define OBJ_1D_MAP    0x0040  // OBJ VRAMを1Dマッピング
 
 // ===== GBA regs (tonc風の素朴版) =====
-#define REG_DISPCNT   (*(volatile uint16_t*)0x04000000)
-#define REG_VCOUNT    (*(volatile uint16_t*)0x04000006)
+#define REG_VCOUNT    (*(volatile uint16_t*)(GBA_IO_BASE + 0x0006))
 
 // Display control bits
 #define DCNT_MODE0    0x0000
@@ -18,27 +32,86 @@
 #define DCNT_OBJ_1D   0x0040
 
 // DMA3 (32bit) 簡易
-#define REG_DMA3SAD   (*(volatile const void**)0x040000D4)
-#define REG_DMA3DAD   (*(volatile void**)0x040000D8)
-#define REG_DMA3CNT   (*(volatile uint32_t*)0x040000DC)
+#define REG_DMA3SAD   (*(volatile const void**)(GBA_IO_BASE + 0x00D4))
+#define REG_DMA3DAD   (*(volatile void**)(GBA_IO_BASE + 0x00D8))
+#define REG_DMA3CNT   (*(volatile uint32_t*)(GBA_IO_BASE + 0x00DC))
 #define DMA_ENABLE    (1u<<31)
 #define DMA_32        (1u<<26)
 
+// タイマー 0（ERAPI が回している。起動時の揺らぎとして読むだけ）
+#define REG_TM0D      (*(volatile uint16_t*)(GBA_IO_BASE + 0x0100))
+
+// タイマー 2/3（計測用。TM3 を TM2 のカスケードにして 32bit のサイクル数にする）
+#define REG_TM2D      (*(volatile uint16_t*)(GBA_IO_BASE + 0x0108))
+#define REG_TM2CNT    (*(volatile uint16_t*)(GBA_IO_BASE + 0x010A))
+#define REG_TM3D      (*(volatile uint16_t*)(GBA_IO_BASE + 0x010C))
+#define REG_TM3CNT    (*(volatile uint16_t*)(GBA_IO_BASE + 0x010E))
+#define TM_CASCADE    0x0004
+#define TM_ENABLE     0x0080
+
+// 割り込み（VBlank だけ使う。ハンドラの入口は BIOS が呼ぶ 0x03007FFC）
+#define REG_DISPSTAT  (*(volatile uint16_t*)(GBA_IO_BASE + 0x0004))
+#define REG_IE        (*(volatile uint16_t*)(GBA_IO_BASE + 0x0200))
+#define REG_IF        (*(volatile uint16_t*)(GBA_IO_BASE + 0x0202))
+#define REG_IME       (*(volatile uint16_t*)(GBA_IO_BASE + 0x0208))
+#define DSTAT_VBL_IRQ 0x0008
+#define IRQ_VBLANK    0x0001
+
 // OAM / OBJ VRAM / OBJ PAL
-#define OAM16         ((volatile uint16_t*)0x07000000)   // attr0/1/2/...
+#define OAM16         ((volatile uint16_t*)(GBA_OAM_BASE))            // attr0/1/2/...
 #define OAM_ATTR(n)   (&OAM16[(n)*4])
-#define OBJ_VRAM8     ((volatile uint8_t*) 0x06010000)   // 0x6010000
-#define OBJ_PAL16     ((volatile uint16_t*)0x05000200)   // 16*16 entries
+#define OBJ_VRAM8     ((volatile uint8_t*) (GBA_VRAM_BASE + 0x10000)) // 0x6010000
+#define OBJ_PAL16     ((volatile uint16_t*)(GBA_PAL_BASE + 0x200))    // 16*16 entries
+#define BG_PAL16      ((volatile uint16_t*)(GBA_PAL_BASE))            // 16*16 entries
+#define BG_VRAM8      ((volatile uint8_t*) (GBA_VRAM_BASE))           // キャラ/スクリーンブロック
+
+// BGxCNT のフィールド
+#define BGCNT_CHAR_BASE(cnt)   (((cnt) >> 2) & 0x3)      // 16KB 単位
+#define BGCNT_SCREEN_BASE(cnt) (((cnt) >> 8) & 0x1F)     // 2KB 単位
+// スクリーンエントリ（4bpp）
+#define BG_SE(tile, pal)       (((tile) & 0x03FF) | (((pal) & 0x0F) << 12))
+
+// I/O レジスタ（0x04000000 からのオフセットで指定）
+#define REG_IO16(ofs)     (*(volatile uint16_t*)(GBA_IO_BASE + (ofs)))
+#define REG_OFS_DISPCNT   0x0000
+#define REG_OFS_BG0CNT    0x0008
+#define REG_OFS_BG1CNT    0x000A
+#define REG_OFS_BG2CNT    0x000C
+#define REG_OFS_BG3CNT    0x000E
+#define REG_OFS_BLDCNT    0x0050
+#define REG_OFS_BLDALPHA  0x0052
+#define REG_OFS_BLDY      0x0054
+#define REG_OFS_LCD_END   0x0060  // LCD 系レジスタの終端（キャッシュ対象範囲）
+
+// BLDCNT / BLDALPHA / BLDY
+#define BLD_BG0           0x0001   // 対象ビット（第1対象。<<8 で第2対象）
+#define BLD_BG1           0x0002
+#define BLD_BG2           0x0004
+#define BLD_BG3           0x0008
+#define BLD_OBJ           0x0010
+#define BLD_BD            0x0020   // バックドロップ
+#define BLD_ALL           0x003F
+#define BLD_TOP(t)        ((t) & 0x3F)
+#define BLD_BOT(t)        (((t) & 0x3F) << 8)
+#define BLD_MODE_OFF      0x0000
+#define BLD_MODE_ALPHA    0x0040
+#define BLD_MODE_WHITE    0x0080
+#define BLD_MODE_BLACK    0x00C0
+#define BLDALPHA_SET(eva, evb) (((eva) & 0x1F) | (((evb) & 0x1F) << 8))
 
 // attr ヘルパ
 #define ATTR0_Y(y)        ((y) & 0x00FF)
 #define ATTR0_MODE_REG    0x0000
+#define ATTR0_MODE_BLEND  0x0400 // 半透明 OBJ（BLDALPHA で第2対象と合成）
 #define ATTR0_4BPP        0x0000
 #define ATTR0_SHAPE_SQ    0x0000
 #define ATTR0_SHAPE_TALL  0x8000
 #define ATTR0_SHAPE_WIDE  0x4000
+#define ATTR0_AFFINE      0x0100 // アフィン（回転・拡縮）
+#define ATTR0_DOUBLE      0x0200 // アフィン時：表示領域を倍角に
 
 #define ATTR1_X(x)        ((x) & 0x01FF)
+#define ATTR1_AFFINE_IDX(m) (((m) & 0x1F) << 9) // アフィン時：行列番号 0..31
 #define ATTR1_SIZE_8x8    0x0000 // shape=square
 #define ATTR1_SIZE_16x16  0x4000 // shape=square
 #define ATTR1_SIZE_32x32  0x8000
@@ -54,7 +127,7 @@
 
 // 公開API
 void spr_init_mode0_obj1d(void);
-void spr_wait_vblank(void);
+void spr_wait_vblank(void);   // BIOS VBlankIntrWait（VBlank 割り込みが有効であること：frame_init）
 void spr_dma_copy32(void* dst, const void* src, uint32_t words);
 
 #endif
@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# アセット変換の内容ハッシュ・キャッシュ（Makefile から呼ぶ）。
+#
+#   asset_cache.py <stamp> --in <入力...> --out <出力...> -- <変換コマンド...>
+#
+# 入力ファイルの中身とコマンド行の SHA-256 が <stamp> に記録済みの値と同じで、出力が
+# すべて揃っていれば変換はせず、出力の時刻を入力に追いつかせるだけ（チェックアウトや
+# タッチで時刻だけ変わった場合）。違えば変換を実行し、成功したらハッシュを <stamp> に書く。
+# コマンド行の先頭（インタプリタのパス）はハッシュに入れない。既定の出力のスタンプは
+# assets/.hash に置いてコミットするので、チェックアウト直後も変換（numpy/Pillow）は要らない。
+import hashlib, os, subprocess, sys
+from pathlib import Path
+
+def main():
+    argv = sys.argv[1:]
+    if len(argv) < 4 or "--" not in argv:
+        print("usage: asset_cache.py <stamp> --in FILES... --out FILES... -- CMD...", file=sys.stderr)
+        sys.exit(2)
+    stamp = Path(argv[0])
+    cut = argv.index("--")
+    opts, cmd = argv[1:cut], argv[cut + 1:]
+    ins, outs, cur = [], [], None
+    for a in opts:
+        if a in ("--in", "--out"):
+            cur = ins if a == "--in" else outs
+        elif cur is not None:
+            cur.append(a)
+
+    h = hashlib.sha256()
+    h.update("\0".join(cmd[1:]).encode())
+    for f in ins:
+        h.update(b"\0" + f.encode() + b"\0")
+        h.update(Path(f).read_bytes())
+    digest = h.hexdigest()
+
+    old = stamp.read_text().strip() if stamp.exists() else ""
+    if old == digest and all(Path(o).exists() for o in outs):
+        # 中身は同じ：出力の時刻を入力の最新に揃えるだけ（それより新しい .o は作り直されない）
+        t = max(os.stat(f).st_mtime_ns for f in ins) if ins else None
+        for o in outs:
+            if t is not None and os.stat(o).st_mtime_ns < t:
+                os.utime(o, ns=(t, t))
+        print(f"[ASSET] cached: {' '.join(outs)}")
+        return
+
+    r = subprocess.run(cmd)
+    if r.returncode != 0:
+        sys.exit(r.returncode)
+    stamp.parent.mkdir(parents=True, exist_ok=True)
+    stamp.write_text(digest + "\n")
+
+if __name__ == "__main__":
+    main()
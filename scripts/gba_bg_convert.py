@@ -11,10 +11,18 @@
 # - 240x160 を左上に配置し、右端の 16px（=2タイル列）を空タイルでパディング
 # - パレット0番色＝左上ピクセル色（空タイルの地色に使う）
 # - 出力配列:
-#     const unsigned int   <name>Tiles[ ... ];   // 1タイル=32B=8ワード
-#     const unsigned short <name>Map  [ 640 ];   // 32x20
-#     const unsigned short <name>Pal  [ 16 ];
-#   さらに .h には <name>TilesLen / MapLen / PalLen を 32/1280/32 などで定義
+#     const unsigned int   <name>TilesLZ  [ ... ]; // タイル（1タイル=32B）の LZ77 ストリーム
+#     const unsigned short <name>MapSparse[ ... ]; // 32x20 マップの疎形式（地＋スパン、下記）
+#     const unsigned short <name>Pal      [ 16 ];
+#     unsigned int   <name>Tiles[ ... ];           // 展開先（起動時に lz77_unpack_wram）
+#     unsigned short <name>Map  [ 640 ];           // 展開先（起動時に bgmap_sparse_expand）
+#   さらに .h には <name>TilesLen / MapLen / PalLen（展開後）と *LZLen / MapSparseLen を定義
+#   MapSparse 以外は起動時だけ使うので .initdata / .initbss に置く（include/scratch.h）
+#
+# 疎マップ（u16 列、include/bgmap.h と同じ形式）:
+#   [0] 地のエントリ  [1] 地の矩形 x | y<<8  [2] 幅 | 高さ<<8  [3] スパン数 N
+#   スパン: x | y<<5 | (len-1)<<10 | run<<15 の後に、run なら 1 エントリ、でなければ len エントリ
+#   矩形の外は 0（空タイル）。右端 2 列のパディングと一面のフェルトはスパンに現れない
 #
 # 使い方:
 #   python3 gba_bg_convert_split.py input.png bg_title
@@ -25,6 +33,8 @@
 import sys
 from pathlib import Path
 from PIL import Image
+import numpy as np
+import gba_lz77, gba_pack
 
 def clamp5(x):  # 0..255 -> 0..31
     return (x * 31 + 127) // 255
@@ -44,109 +54,132 @@ def quantize_16(img_rgba):
         palette_rgb.append((r, g, b))
     return q, palette_rgb
 
-def remap_indices_make_bg0(img_indexed, palette_rgb):
+def remap_indices_make_bg0(arr, palette_rgb):
     # 左上ピクセルの色をパレット0番にする（空タイルの地色に採用）
-    w, h = img_indexed.size
-    src = img_indexed.load()
-    bg_idx = src[0, 0] & 0xF
+    bg_idx = int(arr[0, 0])
     if bg_idx == 0:
-        return img_indexed, palette_rgb
+        return arr, palette_rgb
     # 0 と bg_idx をスワップ
-    map_tbl = list(range(16))
-    map_tbl[0], map_tbl[bg_idx] = map_tbl[bg_idx], map_tbl[0]
-    img2 = Image.new("P", (w, h))
-    img2.putpalette(sum(([r, g, b] for (r, g, b) in palette_rgb), []))
-    dst = img2.load()
-    for y in range(h):
-        for x in range(w):
-            dst[x, y] = map_tbl[src[x, y] & 0xF]
+    lut = np.arange(16, dtype=np.uint8)
+    lut[0], lut[bg_idx] = bg_idx, 0
     pal2 = palette_rgb[:]
     pal2[0], pal2[bg_idx] = pal2[bg_idx], pal2[0]
-    return img2, pal2
+    return lut[arr], pal2
 
-def image_to_tiles_map(qimg):
+def image_to_tiles_map(arr):
     # 入力は 240x160 を想定（8の倍数）。マップは 32x20（=256x160）にする。
-    w, h = qimg.size
+    h, w = arr.shape
     if (w % 8) or (h % 8):
         raise SystemExit(f"ERROR: image size must be multiples of 8 (got {w}x{h})")
     if w > 256 or h > 160:
         raise SystemExit(f"ERROR: image must fit within 256x160 (got {w}x{h})")
 
-    pix = qimg.load()
-    # まずは画像の 30x20 タイル分だけタイル化して辞書化（重複排除）
-    tiles = []               # list[list of 64 indices]
-    tile_dict = {}           # bytes(64) -> tile index
+    # 画像の 30x20 タイル分だけタイル化して重複排除（出現順）
     map_w_src = w // 8       # 30
     map_h = h // 8           # 20
-    tilemap = [[0]*map_w_src for _ in range(map_h)]
-
-    for ty in range(map_h):
-        for tx in range(map_w_src):
-            block = []
-            for y in range(8):
-                for x in range(8):
-                    block.append(pix[tx*8 + x, ty*8 + y] & 0xF)
-            key = bytes(block)
-            if key in tile_dict:
-                idx = tile_dict[key]
-            else:
-                idx = len(tiles)
-                tile_dict[key] = idx
-                tiles.append(block)
-            tilemap[ty][tx] = idx
+    tiles, idx = gba_pack.unique_first(gba_pack.tiles_of(arr, 0, 0, w, h).reshape(-1, 64))
 
     # 先頭に「空タイル（全0）」を挿入し、参照を +1
-    blank = [0]*64
-    tiles.insert(0, blank)
-    for row in tilemap:
-        for i in range(len(row)):
-            row[i] += 1
+    tiles = np.vstack([np.zeros((1, 64), dtype=np.uint8), tiles])
+    tilemap = idx.reshape(map_h, map_w_src) + 1
 
     # 32x20 に右側を空タイルでパディング（2 列分）
     map_w = 32
-    tilemap_32x20 = [[0]*map_w for _ in range(map_h)]
-    for ty in range(map_h):
-        # 左 30 列は元の参照、右の 2 列は 0（空タイル）
-        for tx in range(map_w):
-            tilemap_32x20[ty][tx] = tilemap[ty][tx] if tx < map_w_src else 0
+    tilemap_32x20 = np.zeros((map_h, map_w), dtype=np.int64)
+    tilemap_32x20[:, :map_w_src] = tilemap
 
     return tiles, tilemap_32x20  # tiles[0] は空タイル
 
 def pack_tiles_4bpp_u32_words(tiles):
     # 4bpp パック -> 各タイル 64px -> 32B -> 8 x u32
-    words = []
-    for t in tiles:
-        # バイト列に
-        b = bytearray()
-        for i in range(0, 64, 2):
-            b.append((t[i] & 0xF) | ((t[i+1] & 0xF) << 4))
-        # 4バイトごとに u32 (リトルエンディアン) 化
-        for i in range(0, 32, 4):
-            w = b[i] | (b[i+1] << 8) | (b[i+2] << 16) | (b[i+3] << 24)
-            words.append(w)
-    return words  # len = tiles * 8
+    return [int(w) for w in gba_pack.pack_4bpp(tiles)]  # len = tiles * 8
+
+# ---- 疎マップ ----
+SPAN_MAX = 32
+
+def sparse_encode(tilemap, fill_w, fill_h):
+    # 地＝画像範囲で最も多いエントリ。地（矩形外は 0）と違うセルだけを行ごとのスパンにする
+    area = tilemap[:fill_h, :fill_w]
+    vals, counts = np.unique(area, return_counts=True)
+    fill = int(vals[np.argmax(counts)])
+    base = np.zeros_like(tilemap)
+    base[:fill_h, :fill_w] = fill
+    spans = []
+    for y in range(tilemap.shape[0]):
+        row, diff = tilemap[y], tilemap[y] != base[y]
+        xs = [int(x) for x in np.flatnonzero(diff)]
+        # 1 セルの隙間はつなぐ（ヘッダ 1 語 ≧ 隙間 1 語）
+        segs = []
+        for x in xs:
+            if segs and x - segs[-1][1] <= 2 and x - segs[-1][0] < SPAN_MAX:
+                segs[-1][1] = x + 1
+            else:
+                segs.append([x, x + 1])
+        for x0, x1 in segs:
+            # 3 個以上続く同じエントリは run、残りはそのまま並べる
+            x = x0
+            lit = x0
+            while x < x1:
+                r = x
+                while r < x1 and row[r] == row[x]:
+                    r += 1
+                if r - x >= 3:
+                    if lit < x:
+                        spans.append((lit, y, False, [int(v) for v in row[lit:x]]))
+                    spans.append((x, y, True, [int(row[x])] * (r - x)))
+                    lit = r
+                x = r
+            if lit < x1:
+                spans.append((lit, y, False, [int(v) for v in row[lit:x1]]))
+    out = [fill, 0, fill_w | (fill_h << 8), len(spans)]
+    for x, y, run, ents in spans:
+        out.append(x | (y << 5) | ((len(ents) - 1) << 10) | (int(run) << 15))
+        out += ents[:1] if run else ents
+    return out
+
+def sparse_decode(sp, w=32, h=20):
+    m = np.zeros((h, w), dtype=np.int64)
+    fx, fy, fw, fh = sp[1] & 0xFF, sp[1] >> 8, sp[2] & 0xFF, sp[2] >> 8
+    m[fy:fy + fh, fx:fx + fw] = sp[0]
+    i = 4
+    for _ in range(sp[3]):
+        hd = sp[i]; i += 1
+        x, y, n, run = hd & 31, (hd >> 5) & 31, ((hd >> 10) & 31) + 1, hd >> 15
+        m[y, x:x + n] = sp[i] if run else sp[i:i + n]
+        i += 1 if run else n
+    return m
+
+# 起動時だけ使う配列の置き場所（ereader.ld がイメージ末尾に集め、起動後に scratch へ回す）
+INIT_RO  = '__attribute__((aligned(4), section(".initdata")))'
+INIT_BSS = '__attribute__((aligned(4), section(".initbss")))'
 
 def to_h_guard(name):
     return f"GRIT_{name.upper()}_H"
 
-def write_header(h_path, name, tiles_len_bytes, map_len_bytes, pal_len_bytes):
+def write_header(h_path, name, tiles_len_bytes, map_len_bytes, pal_len_bytes, tiles_lz, map_sp):
     guard = to_h_guard(name)
     with open(h_path, "w", encoding="utf-8") as f:
         f.write("//{{BLOCK(%s)\n\n" % name)
         f.write("//======================================================================\n//\n")
         f.write("//\t%s, 256x160@4, \n" % name)
         f.write("//\t+ palette 16 entries, not compressed\n")
-        f.write("//\t+ tiles (t|f|p reduced) not compressed\n")
-        f.write("//\t+ regular map (flat), not compressed, 32x20 \n")
-        total = pal_len_bytes + tiles_len_bytes + map_len_bytes
-        f.write("//\tTotal size: %d + %d + %d = %d\n//\n" %
-                (pal_len_bytes, tiles_len_bytes, map_len_bytes, total))
+        f.write("//\t+ tiles (t|f|p reduced) lz77 compressed\n")
+        f.write("//\t+ sparse map (fill + spans), 32x20 \n")
+        total = pal_len_bytes + len(tiles_lz) + len(map_sp) * 2
+        f.write("//\tTotal size: %d + %d + %d = %d (raw %d)\n//\n" %
+                (pal_len_bytes, len(tiles_lz), len(map_sp) * 2, total,
+                 pal_len_bytes + tiles_len_bytes + map_len_bytes))
         f.write("//======================================================================\n\n")
         f.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        f.write("/* *LZ は BIOS 互換 LZ77、MapSparse は疎マップ（bgmap.h）。起動時に同名の RAM 配列へ展開する */\n")
         f.write(f"#define {name}TilesLen {tiles_len_bytes}\n")
-        f.write(f"extern const unsigned int {name}Tiles[{tiles_len_bytes//4}];\n\n")
+        f.write(f"#define {name}TilesLZLen {len(tiles_lz)}\n")
+        f.write(f"extern const unsigned int {name}TilesLZ[{len(tiles_lz)//4}];\n")
+        f.write(f"extern unsigned int {name}Tiles[{tiles_len_bytes//4}];\n\n")
         f.write(f"#define {name}MapLen {map_len_bytes}\n")
-        f.write(f"extern const unsigned short {name}Map[{map_len_bytes//2}];\n\n")
+        f.write(f"#define {name}MapSparseLen {len(map_sp) * 2}\n")
+        f.write(f"extern const unsigned short {name}MapSparse[{len(map_sp)}];\n")
+        f.write(f"extern unsigned short {name}Map[{map_len_bytes//2}];\n\n")
         f.write(f"#define {name}PalLen {pal_len_bytes}\n")
         f.write(f"extern const unsigned short {name}Pal[16];\n\n")
         f.write("#endif // %s\n\n" % guard)
@@ -165,34 +198,36 @@ def chunked(iterable, n):
             break
         yield buf
 
-def write_source(c_path, h_basename, name, tiles_words, map_entries, pal_bgr555):
+def write_source(c_path, h_basename, name, tiles_words, map_entries, pal_bgr555, tiles_lz, map_sp):
     with open(c_path, "w", encoding="utf-8") as f:
         f.write("//{{BLOCK(%s)\n\n" % name)
         f.write("//======================================================================\n//\n")
         f.write("//\t%s, 256x160@4,\n" % name)
         f.write("//\t+ palette 16 entries, not compressed\n")
-        f.write("//\t+ tiles (t|f|p reduced) not compressed\n")
-        f.write("//\t+ regular map (flat), not compressed, 32x20\n")
-        f.write("//\tTotal size: 32 + %d + 1280 = %d\n//\n" %
-                (len(tiles_words)*4, 32 + len(tiles_words)*4 + 1280))
+        f.write("//\t+ tiles (t|f|p reduced) lz77 compressed\n")
+        f.write("//\t+ sparse map (fill + spans), 32x20\n")
+        f.write("//\tTotal size: 32 + %d + %d = %d (raw %d)\n//\n" %
+                (len(tiles_lz), len(map_sp) * 2, 32 + len(tiles_lz) + len(map_sp) * 2,
+                 32 + len(tiles_words)*4 + 1280))
         f.write("//======================================================================\n\n")
         f.write(f'#include "{h_basename}"\n\n')
 
-        # Tiles
-        f.write(f"const unsigned int {name}Tiles[{len(tiles_words)}] __attribute__((aligned(4))) =\n{{\n")
-        for row in chunked(tiles_words, 8):  # 8 words(=1タイル)単位で改行
+        # Tiles（LZ77 ストリーム＋展開先）
+        f.write(f"const unsigned int {name}TilesLZ[{len(tiles_lz)//4}] {INIT_RO} =\n{{\n")
+        for row in chunked(gba_lz77.words_le(tiles_lz), 8):
             f.write("    " + ",".join(f"0x{w:08X}" for w in row) + ",\n")
         f.write("};\n\n")
+        f.write(f"unsigned int {name}Tiles[{len(tiles_words)}] {INIT_BSS};\n\n")
 
-        # Map (32x20 = 640 entries)
-        f.write(f"const unsigned short {name}Map[640] __attribute__((aligned(4))) =\n{{\n")
-        # 1行16エントリ表示（見やすさ用）
-        for row in chunked(map_entries, 16):
+        # Map（疎マップ＋展開先）
+        f.write(f"const unsigned short {name}MapSparse[{len(map_sp)}] __attribute__((aligned(4))) =\n{{\n")
+        for row in chunked(map_sp, 8):
             f.write("    " + ",".join(f"0x{v:04X}" for v in row) + ",\n")
         f.write("};\n\n")
+        f.write(f"unsigned short {name}Map[{len(map_entries)}] {INIT_BSS};\n\n")
 
         # Palette (16 entries)
-        f.write(f"const unsigned short {name}Pal[16] __attribute__((aligned(4))) =\n{{\n")
+        f.write(f"const unsigned short {name}Pal[16] {INIT_RO} =\n{{\n")
         f.write("    " + ",".join(f"0x{p:04X}" for p in pal_bgr555) + "\n")
         f.write("};\n\n")
         f.write("//}}BLOCK(%s)\n" % name)
@@ -227,36 +262,37 @@ def main():
     qimg, pal_rgb = quantize_16(img)
 
     # 左上色をパレット0番へ
-    qimg, pal_rgb = remap_indices_make_bg0(qimg, pal_rgb)
+    arr, pal_rgb = remap_indices_make_bg0(gba_pack.indices(qimg), pal_rgb)
 
     # タイル化 & 右側パディング（32x20 マップ）
-    tiles, tilemap = image_to_tiles_map(qimg)
+    tiles, tilemap = image_to_tiles_map(arr)
 
     # 4bpp パック（u32ワード列）
     tiles_words = pack_tiles_4bpp_u32_words(tiles)
     tiles_len_bytes = len(tiles_words) * 4  # 1ワード=4B
 
     # マップ（下位10bit=タイル番号、パレット=0、H/Vフリップ=0）
-    map_entries = []
-    for ty in range(20):
-        for tx in range(32):
-            idx = tilemap[ty][tx] & 0x03FF
-            entry = idx
-            map_entries.append(entry)
+    map_entries = [int(v) for v in (tilemap & 0x03FF).reshape(-1)]
     map_len_bytes = len(map_entries) * 2  # u16
 
     # パレット（BGR555）
     pal_bgr555 = [rgb_to_bgr555(rgb) for rgb in pal_rgb]
     pal_len_bytes = 32  # 16*2
 
+    # LZ77（BIOS 互換）
+    tiles_lz = gba_lz77.compress(b"".join(w.to_bytes(4, "little") for w in tiles_words))
+    map_sp   = sparse_encode(tilemap & 0x03FF, w // 8, h // 8)
+    if not np.array_equal(sparse_decode(map_sp), tilemap & 0x03FF):
+        raise SystemExit("ERROR: sparse map round-trip mismatch")
+
     # .h
-    write_header(out_h, name, tiles_len_bytes, map_len_bytes, pal_len_bytes)
+    write_header(out_h, name, tiles_len_bytes, map_len_bytes, pal_len_bytes, tiles_lz, map_sp)
     # .c
-    write_source(out_c, f"{name}.h", name, tiles_words, map_entries, pal_bgr555)
+    write_source(out_c, f"{name}.h", name, tiles_words, map_entries, pal_bgr555, tiles_lz, map_sp)
 
     print(f"[OK] Wrote:\n  {out_h}\n  {out_c}")
-    print(f"     Tiles: {len(tiles_words)//8} tiles ({tiles_len_bytes} bytes)")
-    print(f"     Map:   32x20 ({map_len_bytes} bytes)")
+    print(f"     Tiles: {len(tiles_words)//8} tiles ({tiles_len_bytes} bytes -> LZ77 {len(tiles_lz)})")
+    print(f"     Map:   32x20 ({map_len_bytes} bytes -> sparse {len(map_sp) * 2}, {map_sp[3]} spans)")
     print(f"     Pal:   16 entries ({pal_len_bytes} bytes)")
 
 if __name__ == "__main__":
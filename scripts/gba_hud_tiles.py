@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# HUD 用の小さな BG タイルセット（数字・手番マーカー・状態アイコン）を
+# grit 風の include/hud_tiles.h / src/hud_tiles.c に出力する。
+# 画像は持たず、下の 8x8 ドット絵から直接 4bpp タイルにする。
+#
+# 使い方:
+#   python3 scripts/gba_hud_tiles.py
+#
+# ドット絵の記号 -> パレット番号
+#   .  0 透明（下の背景色が見える）
+#   #  1 白（数字）
+#   o  2 影
+#   y  3 黄（手番）
+#   r  4 赤（革命）
+#   b  5 青（11バック）
+#   g  6 緑（しばり）
+
+from pathlib import Path
+import gba_lz77
+
+PALETTE_RGB = [
+    (0, 0, 0),        # 0: 透明
+    (248, 248, 248),  # 1: 白
+    (24, 24, 40),     # 2: 影
+    (248, 216, 48),   # 3: 黄
+    (232, 56, 48),    # 4: 赤
+    (64, 120, 240),   # 5: 青
+    (56, 184, 72),    # 6: 緑
+] + [(0, 0, 0)] * 9
+
+SYMBOLS = {".": 0, "#": 1, "o": 2, "y": 3, "r": 4, "b": 5, "g": 6}
+
+# (定数名, 8 行のドット絵)
+GLYPHS = [
+    ("DIGIT_0", [".###....", "#o.#o...", "#o.#o...", "#o.#o...", "#o.#o...", "#o.#o...", ".###o...", "..ooo..."]),
+    ("DIGIT_1", ["..#.....", ".##o....", "..#o....", "..#o....", "..#o....", "..#o....", ".###o...", "..ooo..."]),
+    ("DIGIT_2", [".###....", "#o.#o...", "...#o...", "..#oo...", ".#oo....", "#oo.....", "####o...", ".oooo..."]),
+    ("DIGIT_3", [".###....", "#o.#o...", "...#o...", ".##oo...", "...#o...", "#o.#o...", ".###o...", "..ooo..."]),
+    ("DIGIT_4", ["...#....", "..##o...", ".#.#o...", "#o.#o...", "####o...", "...#o...", "...#o...", "....o..."]),
+    ("DIGIT_5", ["####....", "#oooo...", "###.....", "...#....", "...#o...", "#o.#o...", ".###o...", "..ooo..."]),
+    ("DIGIT_6", [".###....", "#oo.o...", "#o......", "###.....", "#o.#....", "#o.#o...", ".###o...", "..ooo..."]),
+    ("DIGIT_7", ["####....", ".oo#o...", "...#o...", "..#oo...", "..#o....", ".#oo....", ".#o.....", "..o....."]),
+    ("DIGIT_8", [".###....", "#o.#o...", "#o.#o...", ".###o...", "#oo#o...", "#o.#o...", ".###o...", "..ooo..."]),
+    ("DIGIT_9", [".###....", "#o.#o...", "#o.#o...", ".####...", "..oo#o..", "#o.#oo..", ".###o...", "..ooo..."]),
+    ("TURN",    ["........", "yy......", "yyyy....", "yyyyyy..", "yyyyyy..", "yyyy....", "yy......", "........"]),
+    ("REV",     ["rrrrrrr.", "r##.#rr.", "r#r#r#r.", "r##rr#r.", "r#r#r#r.", "r#r#r#r.", "rrrrrrr.", "........"]),
+    ("JBACK",   ["bbbbbbb.", "bbb###b.", "bbbb#bb.", "bbbb#bb.", "b#bb#bb.", "bb##bbb.", "bbbbbbb.", "........"]),
+    ("SIBARI",  ["ggggggg.", "gg###gg.", "g#ggggg.", "gg##ggg.", "gggg#gg.", "g###ggg.", "ggggggg.", "........"]),
+]
+
+def clamp5(x): return (x * 31 + 127) // 255
+def rgb_to_bgr555(rgb):
+    r, g, b = rgb
+    return (clamp5(b) << 10) | (clamp5(g) << 5) | clamp5(r)
+
+def glyph_to_words(rows):
+    if len(rows) != 8 or any(len(r) != 8 for r in rows):
+        raise SystemExit("glyph must be 8x8")
+    words = []
+    for row in rows:
+        w = 0
+        for x, ch in enumerate(row):      # 左=下位ニブル
+            w |= SYMBOLS[ch] << (x * 4)
+        words.append(w)
+    return words
+
+def main():
+    root = Path.cwd()
+    base = "hud_tiles"
+    words = []
+    for _, rows in GLYPHS:
+        words += glyph_to_words(rows)
+    pal = [rgb_to_bgr555(c) for c in PALETTE_RGB]
+    # VRAM へ直接展開する（bgmap_alloc_tiles_lz → LZ77UnCompVram）
+    lz = gba_lz77.words_le(gba_lz77.compress(b"".join(w.to_bytes(4, "little") for w in words)))
+
+    inc = root / "include" / f"{base}.h"
+    src = root / "src" / f"{base}.c"
+    with open(inc, "w", encoding="utf-8") as f:
+        f.write("//{{BLOCK(%s)\n\n" % base)
+        f.write("//======================================================================\n//\n")
+        f.write("//  HUD tiles, 8x8@4, %d tiles (scripts/gba_hud_tiles.py)\n//\n" % len(GLYPHS))
+        f.write("//======================================================================\n\n")
+        f.write("#ifndef GRIT_HUD_TILES_H\n#define GRIT_HUD_TILES_H\n\n")
+        for i, (name, _) in enumerate(GLYPHS):
+            f.write(f"#define HUD_TILE_{name} {i}\n")
+        f.write(f"#define HUD_TILE_COUNT {len(GLYPHS)}\n\n")
+        f.write(f"#define hud_tilesTilesLen {len(words)*4}\n")
+        f.write(f"#define hud_tilesTilesLZLen {len(lz)*4}\n")
+        f.write(f"extern const unsigned int hud_tilesTilesLZ[{len(lz)}];\n\n")
+        f.write("#define hud_tilesPalLen 32\n")
+        f.write("extern const unsigned short hud_tilesPal[16];\n\n")
+        f.write("#endif // GRIT_HUD_TILES_H\n\n")
+        f.write("//}}BLOCK(%s)\n" % base)
+
+    with open(src, "w", encoding="utf-8") as f:
+        f.write(f'#include "{base}.h"\n\n')
+        # 起動時の dmaq_flush で VRAM に展開したら使わない（.initdata、起動後に scratch へ回る）
+        f.write(f"const unsigned int hud_tilesTilesLZ[{len(lz)}] __attribute__((aligned(4), section(\".initdata\"))) = {{\n")
+        for i, w in enumerate(lz):
+            f.write(("  " if i % 8 == 0 else "") + f"0x{w:08X}," + ("\n" if i % 8 == 7 else " "))
+        if len(lz) % 8: f.write("\n")
+        f.write("};\n\n")
+        f.write("const unsigned short hud_tilesPal[16] __attribute__((aligned(4))) = {\n  ")
+        f.write(",".join(f"0x{p:04X}" for p in pal))
+        f.write("\n};\n")
+    print(f"[OK] include/{base}.h, src/{base}.c 生成（タイル {len(words)*4} -> LZ77 {len(lz)*4} B）")
+
+if __name__ == "__main__":
+    main()
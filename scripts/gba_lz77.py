@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# GBA BIOS 互換の LZ77（SWI 0x11 LZ77UnCompWram / 0x12 LZ77UnCompVram）圧縮。
+#
+#   ヘッダ  u32 = 0x10 | (展開後サイズ << 8)
+#   以降    フラグ 1 バイト（MSB から 8 ブロック分）＋ブロック
+#           0 = 生 1 バイト
+#           1 = 参照 2 バイト: [長さ-3:4][距離-1:12]  長さ 3..18 / 距離 1..4096
+#   末尾は 4 バイト境界まで 0 で埋める
+#
+# VRAM へ直接展開する（LZ77UnCompVram）ストリームは 16bit 単位で書かれるため、
+# 距離 1 の参照（直前 1 バイトのコピー）を使わない。既定でそうする。
+#
+# 単体でも使える:
+#   python3 scripts/gba_lz77.py in.bin out.lz [--wram]
+import sys
+from pathlib import Path
+
+MIN_LEN, MAX_LEN = 3, 18
+MAX_DISP = 4096
+
+def compress(data: bytes, vram_safe: bool = True) -> bytes:
+    data = bytes(data)
+    n = len(data)
+    if n >= 1 << 24:
+        raise ValueError("LZ77: data too large")
+    min_disp = 2 if vram_safe else 1
+    out = bytearray((0x10 | (n << 8)).to_bytes(4, "little"))
+    heads = {}                       # 3 バイト → 出現位置のリスト（新しい順に探す）
+    i = 0
+    while i < n:
+        flag_pos = len(out); out.append(0)
+        flags = 0
+        for bit in range(8):
+            if i >= n:
+                break
+            best_len, best_disp = 0, 0
+            if i + MIN_LEN <= n:
+                cand = heads.get(data[i:i + MIN_LEN], ())
+                limit = min(MAX_LEN, n - i)
+                for p in reversed(cand):
+                    d = i - p
+                    if d > MAX_DISP: break
+                    if d < min_disp: continue
+                    l = MIN_LEN
+                    while l < limit and data[p + l] == data[i + l]:
+                        l += 1
+                    if l > best_len:
+                        best_len, best_disp = l, d
+                        if l == limit: break
+            step = best_len if best_len >= MIN_LEN else 1
+            if step > 1:
+                flags |= 0x80 >> bit
+                v = ((best_len - MIN_LEN) << 12) | (best_disp - 1)
+                out += bytes(((v >> 8) & 0xFF, v & 0xFF))
+            else:
+                out.append(data[i])
+            for k in range(i, min(i + step, n - MIN_LEN + 1)):
+                heads.setdefault(data[k:k + MIN_LEN], []).append(k)
+            i += step
+        out[flag_pos] = flags
+    while len(out) & 3:
+        out.append(0)
+    return bytes(out)
+
+def decompress(src: bytes) -> bytes:
+    hdr = int.from_bytes(src[:4], "little")
+    if hdr & 0xFF != 0x10:
+        raise ValueError("LZ77: bad header")
+    n = hdr >> 8
+    out = bytearray()
+    i = 4
+    while len(out) < n:
+        flags = src[i]; i += 1
+        for bit in range(8):
+            if len(out) >= n: break
+            if flags & (0x80 >> bit):
+                v = (src[i] << 8) | src[i + 1]; i += 2
+                l, d = (v >> 12) + MIN_LEN, (v & 0xFFF) + 1
+                for _ in range(l):
+                    out.append(out[-d])
+            else:
+                out.append(src[i]); i += 1
+    return bytes(out[:n])
+
+def words_le(b: bytes):
+    """u32 配列として C に書くためのワード列（4 バイト境界までは compress が埋める）"""
+    return [int.from_bytes(b[k:k + 4], "little") for k in range(0, len(b), 4)]
+
+if __name__ == "__main__":
+    args = [a for a in sys.argv[1:] if not a.startswith("--")]
+    if len(args) != 2:
+        print("usage: gba_lz77.py <in.bin> <out.lz> [--wram]", file=sys.stderr)
+        sys.exit(1)
+    raw = Path(args[0]).read_bytes()
+    lz = compress(raw, vram_safe="--wram" not in sys.argv[1:])
+    assert decompress(lz) == raw
+    Path(args[1]).write_bytes(lz)
+    print(f"[LZ77] {args[0]}: {len(raw)} -> {len(lz)} B")
@@ -2,9 +2,17 @@
 # -*- coding: utf-8 -*-
 # 240x160 PNG と、領域JSON([{name,x,y,w,h},...])を GBA OBJ(4bpp)用の
 # obj_atlas.c/.h にまとめる。
-# python3 scripts/gba_obj_convert_atlas_regions.py assets/splite.png assets/splite_regions.json obj_atlas
+# 8x8 タイルは全スプライトで重複を除いて1本のプールに格納し、スプライトごとには
+# OBJ 1D 順のタイル番号列（objAtlasTileIndex）だけを持つ。VRAM 上の並びは転送時に組み立てる。
+# python3 scripts/gba_obj_convert_atlas_regions.py assets/splite.png assets/splite_regions.json obj_atlas [--proc-faces]
+#
+# カード表面（H_1..C_13）からは常に「共通テンプレート＋1bpp ランク字形＋1bpp スート」を抽出して
+# include/card_glyphs.h / src/card_glyphs.c に出力する（実行時展開 = src/cardface.c 用）。
+# --proc-faces を付けると、アトラスからカード表面 52 枚を外す（make CARD_FACES=proc と組で使う）。
 
-import sys, json
+import sys, json, re
+import numpy as np
+import gba_lz77, gba_pack
 from pathlib import Path
 from PIL import Image
 
@@ -18,6 +26,26 @@ def rgb_to_bgr555(rgb):
     r,g,b = rgb
     return (clamp5(b) << 10) | (clamp5(g) << 5) | clamp5(r)
 
+# ==== パレット派生（カードの状態表示用。OBJ パレットバンクを切り替えるだけで見た目が変わる）====
+# (名前, 目標色 RGB, 混ぜる割合)  目標色 None は単純な明度倍率
+PAL_VARIANTS = [
+    ("NORMAL",    None,          1.00),
+    ("DIMMED",    None,          0.50),   # 出せないカード
+    ("HIGHLIGHT", (255,255,255), 0.35),   # 出せるカード
+    ("SELECTED",  (255,220, 48), 0.40),   # 選択中
+]
+
+def make_pal_variant(pal_rgb, target, amount):
+    out = []
+    for i, (r, g, b) in enumerate(pal_rgb):
+        if i == 0:                      # 0 番は透明色のまま
+            out.append((r, g, b)); continue
+        if target is None:
+            out.append(tuple(min(255, int(round(c * amount))) for c in (r, g, b)))
+        else:
+            out.append(tuple(int(round(c + (t - c) * amount)) for c, t in zip((r, g, b), target)))
+    return out
+
 def quantize_16(img_rgba):
     q = img_rgba.convert("P", palette=Image.ADAPTIVE, colors=16)
     pal = q.getpalette()[:16*3]
@@ -34,49 +62,183 @@ def size_code(px):
     return 0x08 if px <= 8 else (0x06 if px <= 16 else (0x04 if px <= 32 else 0x02))
 
 WORDS_PER_TILE = 8  # 8x8(4bpp)=32B=8words
+MAX_UNIQUE_TILES = 256  # タイル番号は u8
+
+# ==== OBJ 形状（GBA 正式仕様）====
+# (w, h) -> (shape, size)   shape: 0=正方形 1=横長 2=縦長 / size: attr1 の 0..3
+OBJ_SHAPES = {
+    (8, 8): (0, 0), (16, 16): (0, 1), (32, 32): (0, 2), (64, 64): (0, 3),
+    (16, 8): (1, 0), (32, 8): (1, 1), (32, 16): (1, 2), (64, 32): (1, 3),
+    (8, 16): (2, 0), (8, 32): (2, 1), (16, 32): (2, 2), (32, 64): (2, 3),
+}
+
+def decompose_obj(w, h, max_h=64):
+    """w x h（8の倍数）を GBA の OBJ 形状の組み合わせに分解する。
+    上から帯状に切り、各帯は左から入る最大幅の形状で埋める。
+    戻り値: [(dx, dy, pw, ph), ...]（OAM を並べる順＝VRAM に並べる順）"""
+    if (w, h) in OBJ_SHAPES:
+        return [(0, 0, w, h)]
+    pieces = []
+    y = 0
+    while y < h:
+        hs = max(v for v in (8, 16, 32, 64) if v <= min(h - y, max_h))
+        x = 0
+        while x < w:
+            widths = [pw for (pw, ph) in OBJ_SHAPES if ph == hs and pw <= w - x]
+            if widths:
+                pw = max(widths)
+                pieces.append((x, y, pw, hs))
+                x += pw
+            else:
+                # この帯の高さでは入らない残り幅（例: 高さ64で幅16）は低い帯で埋める
+                for (dx, dy, pw, ph) in decompose_obj(w - x, hs, hs // 2):
+                    pieces.append((x + dx, y + dy, pw, ph))
+                x = w
+        y += hs
+    return pieces
 
 def rect_to_words(pix, x, y, w_px, h_px):
+    # 行優先（左→右、上→下）のタイル列を 4bpp ワードに（GBA 正式: 左=下位 nibble）
     assert (w_px % 8) == 0 and (h_px % 8) == 0
-    WT = w_px // 8  # 横タイル数
-    HT = h_px // 8  # 縦タイル数
+    return [int(w) for w in gba_pack.pack_4bpp(gba_pack.tiles_of(pix, x, y, w_px, h_px))]
+
+def rect_to_obj_words(pix, x, y, w_px, h_px, pieces):
+    # OBJ 1D マッピングでそのまま使える並び：ピース順に、各ピース内は行優先
     out_words = []
+    for (dx, dy, pw, ph) in pieces:
+        out_words += rect_to_words(pix, x + dx, y + dy, pw, ph)
+    return out_words
 
-    # 行優先（左→右、上→下）
-    for ty in range(HT):
-        for tx in range(WT):
-            base_x = x + tx * 8
-            base_y = y + ty * 8
-            tile_bytes = bytearray(32)
-            bi = 0
-            for yy in range(8):
-                row_y = base_y + yy
-                p0 = pix[base_x + 0, row_y] & 0xF
-                p1 = pix[base_x + 1, row_y] & 0xF
-                p2 = pix[base_x + 2, row_y] & 0xF
-                p3 = pix[base_x + 3, row_y] & 0xF
-                p4 = pix[base_x + 4, row_y] & 0xF
-                p5 = pix[base_x + 5, row_y] & 0xF
-                p6 = pix[base_x + 6, row_y] & 0xF
-                p7 = pix[base_x + 7, row_y] & 0xF
-
-                # GBA 正式: 左=下位 nibble
-                tile_bytes[bi+0] = (p1 << 4) | p0
-                tile_bytes[bi+1] = (p3 << 4) | p2
-                tile_bytes[bi+2] = (p5 << 4) | p4
-                tile_bytes[bi+3] = (p7 << 4) | p6
-                bi += 4
-
-            # 32B -> 8 words
-            for i in range(0, 32, 4):
-                w = (tile_bytes[i+0]
-                    | (tile_bytes[i+1] << 8)
-                    | (tile_bytes[i+2] << 16)
-                    | (tile_bytes[i+3] << 24))
-                out_words.append(w)
+class TilePool:
+    """重複を除いたタイルのプール（出現順）。add() はタイル番号を返す"""
+    def __init__(self):
+        self.words, self.index = [], {}
+    def add(self, tile_words):
+        key = tuple(tile_words)
+        if key not in self.index:
+            self.index[key] = len(self.words) // WORDS_PER_TILE
+            self.words += tile_words
+        return self.index[key]
+    def count(self):
+        return len(self.words) // WORDS_PER_TILE
 
-    return out_words
+# ==== 手続き的カード表面（1bpp 字形＋スート） ====
+FACE_RE   = re.compile(r"^([HDSC])_(\d+)$")
+FACE_SUIT = "HDSC"                 # SUIT_HEARTS..SUIT_CLUBS の順
+FACE_W, FACE_H = 16, 32
+
+def extract_card_glyphs(pix, rects):
+    """表面 = テンプレート（全カードで最多の色）＋ランク字形（上側）＋スート（下側）。
+    字形とスートはスート毎の単色。完全に再現できなければ None を返す"""
+    faces = {}
+    for r in rects:
+        m = FACE_RE.match(str(r["name"]))
+        if m and int(r["w"]) == FACE_W and int(r["h"]) == FACE_H:
+            x, y = int(r["x"]), int(r["y"])
+            faces[(FACE_SUIT.index(m.group(1)), int(m.group(2)))] = pix[y:y + FACE_H, x:x + FACE_W]
+    if len(faces) != 52 or any((s, n) not in faces for s in range(4) for n in range(1, 14)):
+        return None, "faces H/D/S/C_1..13 (16x32) not all present"
+    F = np.stack([np.stack([faces[(s, n)] for n in range(1, 14)]) for s in range(4)])  # (4,13,H,W)
+
+    # テンプレート：4スートすべてに現れる色（無ければ＝全カードでインクの画素なので面全体の地色）
+    counts = np.stack([(F == v).sum(axis=(0, 1)) for v in range(16)])          # (16,H,W)
+    common = np.stack([(F == v).any(axis=1).all(axis=0) for v in range(16)])   # (16,H,W)
+    ground = int(np.bincount(F.reshape(-1), minlength=16).argmax())
+    best = np.where(common, counts, -1).argmax(axis=0)
+    tpl = np.where(common.any(axis=0), best, ground).astype(np.uint8)
+
+    # スートごとのインク色（テンプレートと違う画素はすべてこの色であること）
+    diff = F != tpl
+    ink = []
+    for s in range(4):
+        cols = np.unique(F[s][diff[s]])
+        if len(cols) != 1:
+            return None, f"suit {FACE_SUIT[s]}: ink is not a single colour {cols.tolist()}"
+        ink.append(int(cols[0]))
+
+    # 行ごとの 1bpp マスク（bit x = 列 x）
+    M = (diff.astype(np.int64) << np.arange(FACE_W)).sum(axis=-1)               # (4,13,H)
+
+    # 上下の境界：上側はランクだけ、下側はスートだけで決まる行で分ける
+    split = None
+    for sy in range(1, FACE_H):
+        if (M[:, :, :sy] == M[0:1, :, :sy]).all() and (M[:, :, sy:] == M[:, 0:1, sy:]).all():
+            split = sy; break
+    if split is None:
+        return None, "no row splits rank glyphs from suit pips"
+
+    rank_rows = M[0, :, :split].tolist()
+    pip_rows  = M[:, 0, split:].tolist()
+
+    def vbox(rows_list, y0):
+        used = [i for i in range(len(rows_list[0])) if any(r[i] for r in rows_list)]
+        return (y0 + used[0], used[-1] - used[0] + 1) if used else (y0, 0)
+    ry, rh = vbox(rank_rows, 0)
+    py, ph = vbox(pip_rows, split)
+    allbits = int(np.bitwise_or.reduce(M[0, :, :split].reshape(-1)))
+    rx = (allbits & -allbits).bit_length() - 1 if allbits else 0
+    if allbits >> rx >= 0x100:
+        return None, "rank glyphs wider than 8px"
+
+    rank = [[rr[y] >> rx for y in range(ry, ry + rh)] for rr in rank_rows]
+    pip  = [[pr[y - split] for y in range(py, py + ph)] for pr in pip_rows]
+
+    # テンプレートは行単位で重複除去（1行 = 左右タイルの 1 ワードずつ）
+    row_w = (tpl.astype(np.uint32).reshape(FACE_H, 2, 8) << (np.arange(8, dtype=np.uint32) * 4)).sum(axis=2)
+    rows, idx = gba_pack.unique_first(row_w)
+    tpl_rows = [tuple(int(v) for v in r) for r in rows]
+    tpl_idx  = [int(i) for i in idx]
+
+    return {"ink": ink, "rank": rank, "pip": pip, "rx": rx, "ry": ry, "rh": rh,
+            "py": py, "ph": ph, "tpl_rows": tpl_rows, "tpl_idx": tpl_idx}, None
+
+def card_glyphs_bytes(g):
+    return (len(g["tpl_idx"]) + len(g["tpl_rows"]) * 8 + 13 * g["rh"] + 4 * g["ph"] * 2 + 4)
+
+def write_card_glyphs(proj_root, g):
+    base = "card_glyphs"
+    inc = proj_root / "include" / f"{base}.h"
+    src = proj_root / "src"     / f"{base}.c"
+    inc.parent.mkdir(parents=True, exist_ok=True)
+    src.parent.mkdir(parents=True, exist_ok=True)
+    with open(inc, "w", encoding="utf-8") as f:
+        f.write("//{{BLOCK(%s)\n\n" % base)
+        f.write("//======================================================================\n//\n")
+        f.write(f"//  card faces as template + 1bpp rank/suit, {card_glyphs_bytes(g)} bytes\n")
+        f.write("//  Auto-generated by scripts/gba_obj_convert_atlas_regions.py. DO NOT EDIT.\n//\n")
+        f.write("//======================================================================\n\n")
+        f.write("#ifndef GRIT_CARD_GLYPHS_H\n#define GRIT_CARD_GLYPHS_H\n\n")
+        f.write(f"#define CARDGLYPH_RANK_X {g['rx']}\n#define CARDGLYPH_RANK_Y {g['ry']}\n#define CARDGLYPH_RANK_H {g['rh']}\n")
+        f.write(f"#define CARDGLYPH_PIP_Y {g['py']}\n#define CARDGLYPH_PIP_H {g['ph']}\n")
+        f.write(f"#define CARDGLYPH_TPL_ROWS {len(g['tpl_rows'])}\n\n")
+        f.write("/* テンプレート：面の各行（32行）がどの行パターンか。パターン = {左タイル, 右タイル} の 4bpp 1 ワード */\n")
+        f.write("extern const unsigned char cardGlyphTplRow[32];\n")
+        f.write(f"extern const unsigned int  cardGlyphTplWords[{len(g['tpl_rows'])}][2];\n")
+        f.write("/* ランク字形 [1..13 → 0..12]（bit0 = 左端、RANK_X だけ右へずらして置く）とスート [SUIT_*] */\n")
+        f.write(f"extern const unsigned char  cardGlyphRank[13][{max(1, g['rh'])}];\n")
+        f.write(f"extern const unsigned short cardGlyphPip[4][{max(1, g['ph'])}];\n")
+        f.write("extern const unsigned char  cardGlyphInk[4];\n\n")
+        f.write("#endif // GRIT_CARD_GLYPHS_H\n\n")
+        f.write("//}}BLOCK(%s)\n" % base)
+    with open(src, "w", encoding="utf-8") as f:
+        f.write(f'#include "{base}.h"\n\n')
+        f.write("const unsigned char cardGlyphTplRow[32] = { " + ",".join(map(str, g["tpl_idx"])) + " };\n")
+        f.write(f"const unsigned int cardGlyphTplWords[{len(g['tpl_rows'])}][2] __attribute__((aligned(4))) = {{\n")
+        for a, b in g["tpl_rows"]:
+            f.write(f"  {{ 0x{a:08X}, 0x{b:08X} }},\n")
+        f.write("};\n\n")
+        f.write(f"const unsigned char cardGlyphRank[13][{max(1, g['rh'])}] = {{\n")
+        for n, rr in enumerate(g["rank"], 1):
+            f.write("  { " + ",".join(f"0x{v:02X}" for v in rr or [0]) + f" }}, /* {n} */\n")
+        f.write("};\n\n")
+        f.write(f"const unsigned short cardGlyphPip[4][{max(1, g['ph'])}] = {{\n")
+        for s, pr in enumerate(g["pip"]):
+            f.write("  { " + ",".join(f"0x{v:04X}" for v in pr or [0]) + f" }}, /* {FACE_SUIT[s]} */\n")
+        f.write("};\n\n")
+        f.write("const unsigned char cardGlyphInk[4] = { " + ",".join(map(str, g["ink"])) + " };\n")
 
-def write_outputs(proj_root, base, tiles_words, pal_bgr, descs, names):
+def write_outputs(proj_root, base, tiles_words, tile_index, pal_bgr, descs, names, pieces, pal_variants):
+    tiles_lz = gba_lz77.compress(b"".join(w.to_bytes(4, "little") for w in tiles_words))
     inc = proj_root / "include" / f"{base}.h"
     src = proj_root / "src"     / f"{base}.c"
     inc.parent.mkdir(parents=True, exist_ok=True)
@@ -94,17 +256,43 @@ def write_outputs(proj_root, base, tiles_words, pal_bgr, descs, names):
         f.write("  unsigned short w, h;\n")
         f.write("  unsigned short tiles_per_frame;\n")
         f.write("  unsigned short frames;\n")
-        f.write("  unsigned int   offset_words;\n")
+        f.write("  unsigned short index_first;  /* objAtlasTileIndex の先頭（tiles_per_frame 個） */\n")
         f.write("  unsigned char  width_code;\n")
         f.write("  unsigned char  height_code;\n")
+        f.write("  unsigned short piece_first;  /* objAtlasPieces の先頭 */\n")
+        f.write("  unsigned short piece_count;  /* OBJ 何枚で描くか */\n")
         f.write("} ObjSpriteDesc;\n\n")
 
+        f.write("/* OAM テンプレート：attr0/attr1 の形状・サイズビットと、スプライト先頭からの\n")
+        f.write("   タイルオフセット・表示オフセット。タイル番号列はこの順に 1D で並べてある */\n")
+        f.write("typedef struct {\n")
+        f.write("  unsigned short attr0;   /* shape */\n")
+        f.write("  unsigned short attr1;   /* size */\n")
+        f.write("  unsigned short tile;\n")
+        f.write("  unsigned char  dx, dy;\n")
+        f.write("} ObjOamPiece;\n\n")
+
+        f.write("/* 重複除去済みのタイルプール。スプライトの VRAM 像は\n")
+        f.write("   objAtlasTileIndex[index_first..] の順にタイルを並べたもの。\n")
+        f.write(f"   {base}TilesLZ（BIOS 互換 LZ77）を起動時に {base}Tiles へ展開して使う */\n")
+        f.write(f"#define {base}TileCount {len(tiles_words)//WORDS_PER_TILE}\n")
         f.write(f"#define {base}TilesLen {len(tiles_words)*4}\n")
-        f.write(f"extern const unsigned int {base}Tiles[{len(tiles_words)}];\n")
+        f.write(f"#define {base}TilesLZLen {len(tiles_lz)}\n")
+        f.write(f"extern const unsigned int {base}TilesLZ[{len(tiles_lz)//4}];\n")
+        f.write(f"extern unsigned int {base}Tiles[{len(tiles_words)}];\n")
+        f.write(f"#define {base}TileIndexLen {len(tile_index)}\n")
+        f.write(f"extern const unsigned char objAtlasTileIndex[{len(tile_index)}];\n")
         f.write(f"#define {base}PalLen 32\n")
         f.write(f"extern const unsigned short {base}Pal[16];\n\n")
 
+        f.write("/* パレット派生：バンク番号 = 派生番号で一度だけ読み込み、attr2 のバンクで切り替える */\n")
+        for i, (nm, _, _) in enumerate(PAL_VARIANTS):
+            f.write(f"#define OBJ_PAL_{nm} {i}\n")
+        f.write(f"#define OBJ_PAL_VARIANTS {len(pal_variants)}\n")
+        f.write(f"extern const unsigned short {base}PalVariants[{len(pal_variants)}][16];\n\n")
+
         f.write(f"extern const ObjSpriteDesc objAtlasSprites[{len(descs)}];\n")
+        f.write(f"extern const ObjOamPiece objAtlasPieces[{len(pieces)}];\n")
         f.write(f"extern const char* objAtlasNames[{len(descs)}];\n")
         f.write(f"#define OBJ_ATLAS_SPRITE_COUNT {len(descs)}\n\n")
         f.write("int objAtlasFindIndex(const char* name);\n\n")
@@ -113,19 +301,38 @@ def write_outputs(proj_root, base, tiles_words, pal_bgr, descs, names):
 
     with open(src, "w", encoding="utf-8") as f:
         f.write(f'#include "{base}.h"\n\n')
-        f.write(f"const unsigned int {base}Tiles[{len(tiles_words)}] __attribute__((aligned(4))) = {{\n")
-        for i, w in enumerate(tiles_words):
+        lz_words = gba_lz77.words_le(tiles_lz)
+        # 展開後は使わない：起動時だけのデータ（.initdata、起動後に scratch へ回る）
+        f.write(f"const unsigned int {base}TilesLZ[{len(lz_words)}] __attribute__((aligned(4), section(\".initdata\"))) = {{\n")
+        for i, w in enumerate(lz_words):
             f.write(("  " if i%8==0 else "") + f"0x{w:08X}," + ("\n" if i%8==7 else " "))
-        if len(tiles_words)%8: f.write("\n")
+        if len(lz_words)%8: f.write("\n")
+        f.write("};\n\n")
+        f.write(f"unsigned int {base}Tiles[{len(tiles_words)}] __attribute__((aligned(4)));\n\n")
+
+        f.write(f"const unsigned char objAtlasTileIndex[{len(tile_index)}] = {{\n")
+        for i, t in enumerate(tile_index):
+            f.write(("  " if i%16==0 else "") + f"{t}," + ("\n" if i%16==15 else " "))
+        if len(tile_index)%16: f.write("\n")
         f.write("};\n\n")
 
         f.write(f"const unsigned short {base}Pal[16] __attribute__((aligned(4))) = {{\n  ")
         f.write(",".join(f"0x{p:04X}" for p in pal_bgr))
         f.write("\n};\n\n")
 
+        f.write(f"const unsigned short {base}PalVariants[{len(pal_variants)}][16] __attribute__((aligned(4))) = {{\n")
+        for (nm, _, _), v in zip(PAL_VARIANTS, pal_variants):
+            f.write("  { " + ",".join(f"0x{p:04X}" for p in v) + f" }}, /* {nm} */\n")
+        f.write("};\n\n")
+
         f.write(f"const ObjSpriteDesc objAtlasSprites[{len(descs)}] = {{\n")
         for d in descs:
-            f.write(f"  {{ {d['w']}, {d['h']}, {d['tiles_per_frame']}, 1, {d['offset_words']}, 0x{d['wcode']:02X}, 0x{d['hcode']:02X} }},\n")
+            f.write(f"  {{ {d['w']}, {d['h']}, {d['tiles_per_frame']}, 1, {d['index_first']}, 0x{d['wcode']:02X}, 0x{d['hcode']:02X}, {d['piece_first']}, {d['piece_count']} }},\n")
+        f.write("};\n\n")
+
+        f.write(f"const ObjOamPiece objAtlasPieces[{len(pieces)}] = {{\n")
+        for pc in pieces:
+            f.write(f"  {{ 0x{pc['attr0']:04X}, 0x{pc['attr1']:04X}, {pc['tile']}, {pc['dx']}, {pc['dy']} }},\n")
         f.write("};\n\n")
 
         f.write(f"const char* objAtlasNames[{len(descs)}] = {{\n")
@@ -138,44 +345,88 @@ def write_outputs(proj_root, base, tiles_words, pal_bgr, descs, names):
         f.write("int objAtlasFindIndex(const char* name){ if(!name) return -1; for(int i=0;i<OBJ_ATLAS_SPRITE_COUNT;++i){ const char* s=objAtlasNames[i]; if(s && _cmp_str(s,name)==0) return i;} return -1; }\n")
 
 def main():
-    if len(sys.argv) < 4:
-        print("usage: gba_obj_convert_atlas_regions.py <image> <manifest.json> <base_name>", file=sys.stderr)
+    args = [a for a in sys.argv[1:] if not a.startswith("--")]
+    proc_faces = "--proc-faces" in sys.argv[1:]
+    # --root=DIR：src/ と include/ をこの下に書く（既定はカレント。作り分けの出力を build/ に置く用）
+    roots = [a.split("=", 1)[1] for a in sys.argv[1:] if a.startswith("--root=")]
+    if len(args) < 3:
+        print("usage: gba_obj_convert_atlas_regions.py <image> <manifest.json> <base_name> [--proc-faces] [--root=DIR]", file=sys.stderr)
         sys.exit(1)
 
-    img_path   = Path(sys.argv[1])
-    manifest   = Path(sys.argv[2])
-    base       = sys.argv[3]
-    proj_root  = Path.cwd()
+    img_path   = Path(args[0])
+    manifest   = Path(args[1])
+    base       = args[2]
+    proj_root  = Path(roots[-1]) if roots else Path.cwd()
 
     img = Image.open(img_path).convert("RGBA")
     imgP, pal_rgb = quantize_16(img)
     pal_bgr = [rgb_to_bgr555(rgb) for rgb in pal_rgb]
-    pix = imgP.load()
+    pal_variants = [[rgb_to_bgr555(c) for c in make_pal_variant(pal_rgb, t, a)]
+                    for (_, t, a) in PAL_VARIANTS]
+    pix = gba_pack.indices(imgP)
 
     rects = json.loads(manifest.read_text(encoding="utf-8"))
     if not isinstance(rects, list):
         raise SystemExit("manifest must be a list of {name,x,y,w,h}")
 
-    tiles_words = []
-    descs, names = [], []
+    glyphs, why = extract_card_glyphs(pix, rects)
+    if glyphs:
+        write_card_glyphs(proj_root, glyphs)
+    elif proc_faces:
+        raise SystemExit(f"--proc-faces: {why}")
+    else:
+        print(f"[WARN] card glyphs not extracted: {why}")
+    if proc_faces:
+        rects = [r for r in rects if not FACE_RE.match(str(r["name"]))]
+
+    pool = TilePool()
+    tile_index = []
+    descs, names, pieces = [], [], []
 
     for r in rects:
         name = str(r["name"]); x=int(r["x"]); y=int(r["y"]); w=int(r["w"]); h=int(r["h"])
         if (w|h) & 7: raise SystemExit(f"{name}: w,h must be multiples of 8")
-        offset_words = len(tiles_words)
-        tiles_words += rect_to_words(pix, x, y, w, h)
+        if w > 255 or h > 255: raise SystemExit(f"{name}: w,h must be <= 255")
+        index_first = len(tile_index)
+        parts = decompose_obj(w, h)
+        words = rect_to_obj_words(pix, x, y, w, h, parts)
+        for i in range(0, len(words), WORDS_PER_TILE):
+            tile_index.append(pool.add(words[i:i+WORDS_PER_TILE]))
+
+        piece_first = len(pieces)
+        tile = 0
+        for (dx, dy, pw, ph) in parts:
+            shape, size = OBJ_SHAPES[(pw, ph)]
+            pieces.append({"attr0": shape << 14, "attr1": size << 14,
+                           "tile": tile, "dx": dx, "dy": dy})
+            tile += (pw // 8) * (ph // 8)
 
         descs.append({
             "name": name,
             "w": w, "h": h,
             "tiles_per_frame": (w//8)*(h//8),
-            "offset_words": offset_words,
+            "index_first": index_first,
             "wcode": size_code(w), "hcode": size_code(h),
+            "piece_first": piece_first, "piece_count": len(parts),
         })
         names.append(name)
 
-    write_outputs(proj_root, base, tiles_words, pal_bgr, descs, names)
+    if pool.count() > MAX_UNIQUE_TILES:
+        raise SystemExit(f"unique tiles {pool.count()} > {MAX_UNIQUE_TILES} (tile index is u8)")
+    if len(tile_index) > 0xFFFF:
+        raise SystemExit("tile index list too long")
+
+    write_outputs(proj_root, base, pool.words, tile_index, pal_bgr, descs, names, pieces, pal_variants)
+    raw = len(tile_index) * 32
+    packed = len(pool.words) * 4 + len(tile_index)
+    lz = len(gba_lz77.compress(b"".join(w.to_bytes(4, "little") for w in pool.words)))
     print(f"[OK] include/{base}.h, src/{base}.c 生成")
+    print(f"     tiles {len(tile_index)} -> {pool.count()} unique, "
+          f"{raw} B -> {packed} B (pool {len(pool.words)*4} + index {len(tile_index)})")
+    print(f"     pool LZ77: {len(pool.words)*4} -> {lz} B")
+    if glyphs:
+        print(f"     card glyphs: {card_glyphs_bytes(glyphs)} B -> include/card_glyphs.h, src/card_glyphs.c"
+              + (" (faces removed from atlas)" if proc_faces else ""))
 
 if __name__ == "__main__":
     main()
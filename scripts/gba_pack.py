@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# 変換スクリプト共通：パレット番号の画像 → 8x8 タイル → 4bpp（左=下位ニブル）→ u32 ワード。
+# すべて numpy の配列演算で行う（画素ごとの Python ループを使わない）。
+import numpy as np
+
+def indices(img_p):
+    """P モード画像 → (h, w) の uint8 パレット番号（下位 4bit）"""
+    return np.asarray(img_p, dtype=np.uint8) & 0xF
+
+def tiles_of(arr, x, y, w, h):
+    """arr[y:y+h, x:x+w] を行優先の 8x8 タイル列 (n, 8, 8) に"""
+    if (w | h) & 7:
+        raise ValueError("w, h must be multiples of 8")
+    sub = arr[y:y + h, x:x + w]
+    return sub.reshape(h // 8, 8, w // 8, 8).swapaxes(1, 2).reshape(-1, 8, 8)
+
+def pack_4bpp(tiles):
+    """(n, 8, 8) → (n*8,) uint32。1 行 = 1 ワード、左の画素が下位ニブル"""
+    t = np.asarray(tiles, dtype=np.uint32).reshape(-1, 8, 8) & 0xF
+    shifts = np.arange(8, dtype=np.uint32) * 4
+    return (t << shifts).sum(axis=2, dtype=np.uint32).reshape(-1)
+
+def unique_first(rows):
+    """行の重複除去（出現順を保つ）。戻り値: (重複なしの行, 各行の番号)"""
+    rows = np.ascontiguousarray(rows)
+    uniq, first, inv = np.unique(rows, axis=0, return_index=True, return_inverse=True)
+    order = np.argsort(first, kind="stable")
+    rank = np.empty_like(order)
+    rank[order] = np.arange(len(order))
+    return uniq[order], rank[np.asarray(inv).reshape(-1)]
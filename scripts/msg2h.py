@@ -1,6 +1,14 @@
 #!/usr/bin/env python3
 #UTF-8のテキストをShift_JISのCバイト列に変換
-import sys, pathlib, re
+# --font を付けると、メッセージで実際に使う文字だけを 8x8 の 4bpp タイルにし（オフライン）、
+# 各メッセージをタイル番号の並び（BG マップにそのままコピーできる形）として出力する。
+#
+# usage:
+#   msg2h.py text/messages_jpn.txt include/messages_autogen.h
+#   msg2h.py text/messages_jpn.txt [include/messages_autogen.h] \
+#       --font assets/msg_font8.txt [--base msg_glyphs]
+#     -> include/<base>.h / src/<base>.c も生成（Makefile の assets から呼ぶ）
+import sys, pathlib, re, argparse
 
 def norm_key(k: str) -> str:
     k = k.strip()
@@ -10,7 +18,7 @@ def norm_key(k: str) -> str:
 def parse_txt(path: pathlib.Path):
     kv = {}
     for line in path.read_text(encoding="utf-8").splitlines():
-        s = line.strip()
+        s = line.strip(" \t")   # 全角空白（U+3000）は値なので残す
         if not s or s.startswith("#"):
             continue
         if "=" in s:
@@ -32,9 +40,119 @@ def emit_header(out_path: pathlib.Path, kv: dict):
             lit = to_sjis_bytes_literal(v)
             f.write(f"static const unsigned char MSG_{k}[] = \"{lit}\";\n")
 
+# ==== グリフアトラス ====
+# パレット番号は HUD（gba_hud_tiles.py）と同じ：0=透明 1=文字 2=影。パレットは HUD のバンクを使う
+INK, SHADOW = 1, 2
+GLYPH = 7          # フォントのドット絵の大きさ（右下 1px は影の分）
+
+def parse_font(path: pathlib.Path):
+    # "[字]" に続く GLYPH 行 x GLYPH 桁のドット絵 -> {字: bool[GLYPH, GLYPH]}
+    import numpy as np
+    font, ch, rows = {}, None, []
+    def close():
+        if ch is None: return
+        if len(rows) != GLYPH or any(len(r) != GLYPH for r in rows):
+            raise SystemExit(f"{path}: glyph [{ch}] must be {GLYPH}x{GLYPH}")
+        font[ch] = np.array([[c == "#" for c in r] for r in rows], dtype=bool)
+    for line in path.read_text(encoding="utf-8").splitlines():
+        s = line.rstrip()
+        if not s or s.startswith("# "):      # 説明行（ドット絵の行は空白を含まない）
+            continue
+        m = re.fullmatch(r"\[(.)\]", s)
+        if m:
+            close(); ch, rows = m.group(1), []
+        elif ch is not None:
+            rows.append(s)
+    close()
+    return font
+
+def collect_chars(kv: dict):
+    # 出現順で重複なし（アトラスの並びを安定させる）
+    return list(dict.fromkeys(ch for v in kv.values() for ch in v))
+
+def build_atlas(kv: dict, font: dict):
+    import numpy as np
+    chars = collect_chars(kv)
+    missing = [c for c in chars if c not in font]
+    if missing:
+        raise SystemExit("msg2h: font has no glyph for: " + " ".join(missing))
+
+    # 全文字をまとめて 8x8 のセルへ：文字 + 右下 1px の影
+    ink = np.zeros((len(chars), 8, 8), dtype=bool)
+    ink[:, :GLYPH, :GLYPH] = np.stack([font[c] for c in chars])
+    shadow = np.zeros_like(ink)
+    shadow[:, 1:, 1:] = ink[:, :-1, :-1]
+    px = np.where(ink, INK, np.where(shadow, SHADOW, 0)).astype(np.uint32)
+
+    # 1 行 = 1 ワード（左=下位ニブル）
+    words = (px << (np.arange(8, dtype=np.uint32) * 4)).sum(axis=2, dtype=np.uint32)
+
+    tiles = [(0,) * 8]                 # タイル0 = 空（透明。メッセージ中では背景に戻す）
+    index = {tiles[0]: 0}
+    glyph_tile = {}
+    for ch, w in zip(chars, words):
+        t = tuple(int(x) for x in w)
+        if t not in index:
+            index[t] = len(tiles); tiles.append(t)
+        glyph_tile[ch] = index[t]
+
+    # メッセージ → {幅タイル, 高さタイル, タイル番号...}（1 文字 = 1 タイル、1 行）
+    seqs = {k: [len(v), 1] + [glyph_tile[ch] for ch in v] for k, v in kv.items()}
+    return chars, tiles, seqs
+
+def emit_atlas(root: pathlib.Path, base: str, chars, tiles, seqs):
+    import gba_lz77
+    raw = b"".join(w.to_bytes(4, "little") for t in tiles for w in t)
+    lz  = gba_lz77.words_le(gba_lz77.compress(raw))
+
+    inc = root / "include" / f"{base}.h"
+    src = root / "src" / f"{base}.c"
+    inc.parent.mkdir(parents=True, exist_ok=True)
+    src.parent.mkdir(parents=True, exist_ok=True)
+    guard = f"GRIT_{base.upper()}_H"
+    with inc.open("w", encoding="utf-8") as f:
+        f.write("//{{BLOCK(%s)\n\n" % base)
+        f.write("//======================================================================\n//\n")
+        f.write(f"//  message glyphs, 8x8@4, {len(chars)} chars -> {len(tiles)} tiles (scripts/msg2h.py)\n")
+        f.write("//  Auto-generated from text/messages_jpn.txt. DO NOT EDIT.\n//\n")
+        f.write("//======================================================================\n\n")
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write(f"#define {base}TileCount {len(tiles)}\n")
+        f.write(f"#define {base}TilesLen {len(raw)}\n")
+        f.write(f"#define {base}TilesLZLen {len(lz) * 4}\n")
+        f.write(f"extern const unsigned int {base}TilesLZ[{len(lz)}];\n\n")
+        f.write("/* メッセージ：{幅タイル, 高さタイル, タイル番号(行優先)...}。0 は透明タイル */\n")
+        for k, s in seqs.items():
+            f.write(f"extern const unsigned short MSGT_{k}[{len(s)}];\n")
+        f.write(f"\n#endif // {guard}\n\n")
+        f.write("//}}BLOCK(%s)\n" % base)
+    with src.open("w", encoding="utf-8") as f:
+        f.write(f'#include "{base}.h"\n\n')
+        f.write("/* 使用文字: " + "".join(chars) + " */\n")
+        # 起動時に VRAM へ展開したら使わない（.initdata、起動後に scratch へ回る）
+        f.write(f"const unsigned int {base}TilesLZ[{len(lz)}] __attribute__((aligned(4), section(\".initdata\"))) = {{\n")
+        for i, w in enumerate(lz):
+            f.write(("  " if i % 8 == 0 else "") + f"0x{w:08X}," + ("\n" if i % 8 == 7 else " "))
+        if len(lz) % 8: f.write("\n")
+        f.write("};\n\n")
+        for k, s in seqs.items():
+            f.write(f"const unsigned short MSGT_{k}[{len(s)}] = {{ " + ",".join(str(v) for v in s) + " };\n")
+    return len(raw), len(lz) * 4
+
 if __name__ == "__main__":
-    # usage: msg2h.py text/messages_jpn.txt include/messages_autogen.h
-    in_txt = pathlib.Path(sys.argv[1])
-    out_h  = pathlib.Path(sys.argv[2])
-    kv = parse_txt(in_txt)
-    emit_header(out_h, kv)
+    ap = argparse.ArgumentParser()
+    ap.add_argument("in_txt")
+    ap.add_argument("out_h", nargs="?", help="Shift_JIS のバイト列ヘッダ（省略可）")
+    ap.add_argument("--font", help="ドット絵フォント（assets/msg_font8.txt）。指定時のみアトラスを出力")
+    ap.add_argument("--base", default="msg_glyphs")
+    a = ap.parse_args()
+
+    kv = parse_txt(pathlib.Path(a.in_txt))
+    if a.out_h:
+        emit_header(pathlib.Path(a.out_h), kv)
+
+    if a.font:
+        chars, tiles, seqs = build_atlas(kv, parse_font(pathlib.Path(a.font)))
+        raw, lz = emit_atlas(pathlib.Path.cwd(), a.base, chars, tiles, seqs)
+        print(f"[OK] include/{a.base}.h, src/{a.base}.c 生成"
+              f"（{len(chars)} 文字 -> {len(tiles)} タイル、{raw} -> LZ77 {lz} B）")
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# プログラム画像のサイズ内訳（シンボル別・モジュール別）と、VPK 圧縮後の寄与・カード枚数を出す。
+#
+#   python3 scripts/size_report.py --elf build/daihugo.elf --gba build/daihugo.gba \
+#       --nm arm-none-eabi-nm --nevpk tools/bin/nevpk [--cards 'build/card-*.raw'] [--out build/size]
+#
+# ・raw  : シンボルのバイト数（nm -S）。.gba の範囲外（bss）は RAM 欄に分けて数える
+# ・vpk  : モジュールの寄与 = VPK(画像全体) - VPK(そのモジュールのバイトを抜いた画像)
+#          シンボルの vpk はモジュールの寄与を raw 比で按分した目安
+# ・モジュールは nm -l の行情報（-g が必要。画像には載らない）から。取れないものは (no line info)
+# ・init : 起動後に scratch へ回収される .initdata/.initbss の大きさ（ereader.ld の __init_start..__init_end）
+# nevpk が無ければ scripts/gba_lz77.py で代用する（値は目安）。
+import argparse, csv, glob, os, re, subprocess, sys, tempfile
+from collections import defaultdict
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+import gba_lz77
+
+def vpk_size(data, nevpk):
+    if not nevpk:
+        return len(gba_lz77.compress(data, vram_safe=False))
+    if len(data) < 64:                  # nevpk はごく短い入力で落ちる。差分の目安なので生のまま数える
+        return len(data)
+    with tempfile.TemporaryDirectory() as td:
+        src, dst = Path(td) / "in.bin", Path(td) / "out.vpk"
+        src.write_bytes(data)
+        r = subprocess.run([nevpk, "-i", str(src), "-o", str(dst), "-c"],
+                           stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        if r.returncode != 0 or not dst.exists():
+            raise SystemExit(f"nevpk failed (rc={r.returncode}) on {len(data)} bytes")
+        return dst.stat().st_size
+
+NM_RE = re.compile(r"^([0-9a-fA-F]+)\s+([0-9a-fA-F]+)\s+(\S)\s+(\S+)(?:\s+(\S+):\d+)?\s*$")
+
+def read_symbols(nm, elf):
+    out = subprocess.run([nm, "-S", "-l", "--defined-only", elf],
+                         check=True, capture_output=True, text=True).stdout
+    syms = []
+    for line in out.splitlines():
+        m = NM_RE.match(line)
+        if not m:
+            continue
+        addr, size, typ, name, path = m.groups()
+        size = int(size, 16)
+        if size == 0:
+            continue
+        mod = os.path.basename(path) if path else "(no line info)"
+        syms.append({"addr": int(addr, 16), "size": size, "type": typ, "name": name, "module": mod})
+    return syms
+
+def read_marks(nm, elf, names):
+    """サイズ 0 の目印シンボル（リンカスクリプトで定義）のアドレス"""
+    out = subprocess.run([nm, elf], check=True, capture_output=True, text=True).stdout
+    marks = {}
+    for line in out.split("\n"):
+        f = line.split()
+        if len(f) == 3 and f[2] in names:
+            marks[f[2]] = int(f[0], 16)
+    return marks
+
+def cut(image, ranges):
+    """ranges（画像内オフセット）を取り除いた画像"""
+    keep, pos = bytearray(), 0
+    for a, b in sorted(ranges):
+        if a > pos: keep += image[pos:a]
+        pos = max(pos, b)
+    keep += image[pos:]
+    return bytes(keep)
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--elf", required=True)
+    ap.add_argument("--gba", required=True)
+    ap.add_argument("--nm", default="arm-none-eabi-nm")
+    ap.add_argument("--nevpk", default="")
+    ap.add_argument("--base", default="0x02000000")
+    ap.add_argument("--cards", default="", help="nedcmake が出した card-*.raw の glob")
+    ap.add_argument("--out", default="", help="<out>_symbols.csv / <out>_modules.csv / <out>.txt")
+    ap.add_argument("--top", type=int, default=30)
+    a = ap.parse_args()
+
+    nevpk = a.nevpk if a.nevpk and os.access(a.nevpk, os.X_OK) else ""
+    base = int(a.base, 0)
+    image = Path(a.gba).read_bytes()
+    syms = read_symbols(a.nm, a.elf)
+    marks = read_marks(a.nm, a.elf, ("__init_start", "__init_end", "__iwram_start", "__iwram_end", "__iwram_lma"))
+    # .iwram は 0x03000000 で動くがロード像は画像の中：ロードアドレスに直して数える
+    if all(k in marks for k in ("__iwram_start", "__iwram_end", "__iwram_lma")):
+        for s in syms:
+            if marks["__iwram_start"] <= s["addr"] < marks["__iwram_end"]:
+                s["addr"] += marks["__iwram_lma"] - marks["__iwram_start"]
+
+    in_img = [s for s in syms if base <= s["addr"] < base + len(image)]
+    ram    = [s for s in syms if not (base <= s["addr"] < base + len(image))]
+
+    covered = bytearray(len(image))
+    mods = defaultdict(lambda: {"raw": 0, "ram": 0, "ranges": []})
+    for s in in_img:
+        o = s["addr"] - base
+        e = min(o + s["size"], len(image))
+        mods[s["module"]]["raw"] += e - o
+        mods[s["module"]]["ranges"].append((o, e))
+        covered[o:e] = b"\1" * (e - o)
+    for s in ram:
+        mods[s["module"]]["ram"] += s["size"]
+    gaps, run = [], None
+    for i, c in enumerate(covered):
+        if not c and run is None: run = i
+        if c and run is not None: gaps.append((run, i)); run = None
+    if run is not None: gaps.append((run, len(image)))
+    if gaps:
+        u = mods["(padding/unattributed)"]
+        u["raw"] += sum(b - a_ for a_, b in gaps); u["ranges"] += gaps
+
+    full = vpk_size(image, nevpk)
+    for name, m in mods.items():
+        m["vpk"] = full - vpk_size(cut(image, m["ranges"]), nevpk) if m["ranges"] else 0
+    for s in in_img:
+        m = mods[s["module"]]
+        s["vpk"] = round(m["vpk"] * s["size"] / m["raw"]) if m["raw"] else 0
+
+    cards = len(glob.glob(a.cards)) if a.cards else 0
+    lines = []
+    lines.append(f"image : {len(image)} B raw, {full} B {'VPK' if nevpk else 'LZ77 (nevpk not found)'}"
+                 + (f", {cards} card(s)" if a.cards else ""))
+    if "__init_start" in marks and "__init_end" in marks:
+        n = marks["__init_end"] - marks["__init_start"]
+        lines.append(f"init  : {n} B ({n / 1024:.1f} KB) reclaimed to scratch after boot")
+    lines.append("")
+    lines.append(f"{'module':28s} {'raw':>7s} {'vpk':>7s} {'ram':>7s}")
+    for name, m in sorted(mods.items(), key=lambda kv: -kv[1]["raw"]):
+        lines.append(f"{name:28s} {m['raw']:7d} {m['vpk']:7d} {m['ram']:7d}")
+    lines.append("")
+    lines.append(f"top {a.top} symbols by raw size")
+    lines.append(f"{'symbol':36s} {'module':20s} {'raw':>6s} {'vpk~':>6s}")
+    for s in sorted(in_img, key=lambda s: -s["size"])[:a.top]:
+        lines.append(f"{s['name'][:36]:36s} {s['module'][:20]:20s} {s['size']:6d} {s['vpk']:6d}")
+    text = "\n".join(lines)
+    print(text)
+
+    if a.out:
+        Path(a.out + ".txt").write_text(text + "\n", encoding="utf-8")
+        with open(a.out + "_modules.csv", "w", newline="") as f:
+            w = csv.writer(f); w.writerow(["module", "raw", "vpk", "ram"])
+            for name, m in sorted(mods.items()):
+                w.writerow([name, m["raw"], m["vpk"], m["ram"]])
+        with open(a.out + "_symbols.csv", "w", newline="") as f:
+            w = csv.writer(f); w.writerow(["symbol", "module", "type", "addr", "raw", "vpk_est"])
+            for s in sorted(syms, key=lambda s: s["addr"]):
+                w.writerow([s["name"], s["module"], s["type"], f"0x{s['addr']:08X}", s["size"], s.get("vpk", 0)])
+
+if __name__ == "__main__":
+    main()
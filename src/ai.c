@@ -1,11 +1,13 @@
 #include "ai.h"
 #include "cards.h"
+#include "arena.h"
 #include <stddef.h>  // NULL
 
 /* 調整パラメータ */
 #define STRAIGHT_MIN  3
 
 /* rank 有効値（革命/JB 反転） */
+IWRAM_CODE
 static u8 rank_effective(u8 r, u8 rev, u8 jb){
     u8 inv = (rev ^ jb) & 1u;
     return inv ? (u8)(19u - r) : r; /* 3..16 を反転マップ */
@@ -21,6 +23,13 @@ typedef struct {
     u8 rank_eff; /* 有効ランク（革命/JB反転後） */
 } CardView;
 
+/* 1 回の思考で使う作業配列（スタックに置かず ARENA_FRAME から借りる） */
+typedef struct {
+    CardView view[20];     /* 手札のビュー */
+    CardView sorted[20];   /* 先出し用：有効ランク順 */
+    CardView suit[20];     /* 階段探し：1 スート分 */
+} AiWork;
+
 static inline u8 suit_of(u8 c){ return CARD_SUIT(c); }
 static inline u8 rank_of(u8 c){ return CARD_RANK(c); }
 static inline int is_joker(u8 c){ return rank_of(c)==16; }
@@ -39,6 +48,7 @@ static inline void cv_swap(CardView* a, CardView* b){
 }
 
 /* 手札をビューに展開（有効ランクを前計算） */
+IWRAM_CODE
 static void build_card_view(const Hand* h, u8 rev, u8 jb, CardView out[20], int* out_n){
     int n=0;
     for (int i=0;i<h->count;++i){
@@ -52,6 +62,7 @@ static void build_card_view(const Hand* h, u8 rev, u8 jb, CardView out[20], int*
 }
 
 /* ランク昇順（同値は suit で安定） */
+IWRAM_CODE
 static void sort_by_eff_rank(CardView a[], int n){
     for (int i=0;i<n;i++){
         for (int j=i+1;j<n;j++){
@@ -64,6 +75,7 @@ static void sort_by_eff_rank(CardView a[], int n){
 }
 
 /* スート毎の枚数を数える（Jokerは除外） */
+IWRAM_CODE
 static void build_histogram_from_view(const CardView* cv, int n, u8 have[17]){
     for (int r=0;r<=16;++r) have[r]=0;
     for (int i=0;i<n;++i){
@@ -74,6 +86,7 @@ static void build_histogram_from_view(const CardView* cv, int n, u8 have[17]){
 /* ---- 出し判定ヘルパ ---- */
 
 /* 同ランク n枚の最小（条件を満たす最小）を pick */
+IWRAM_CODE
 static int pick_min_set_from_view(const CardView* cv, int ncv, u8 need_rank_eff, int need_n,
                                   const FieldState* fs,
                                   u8 out_cards[4], u8* out_n){
@@ -103,12 +116,14 @@ static int pick_min_set_from_view(const CardView* cv, int ncv, u8 need_rank_eff,
 }
 
 /* 階段：同一スートで連番 STRAIGHT_MIN.. 2/Jokerは不可、トップの rank_eff で比較 */
+IWRAM_CODE
 static int pick_min_straight_from_view(const CardView* cv, int ncv, u8 need_top_eff, int need_len,
-                                       const FieldState* fs,
+                                       const FieldState* fs, AiWork* w,
                                        u8 out_cards[4], u8* out_n){
     (void)fs; /* しばりは階段に適用しない仕様 */
+    CardView* arr = w->suit;
     for (u8 s=0; s<4; ++s){
-        CardView arr[20]; int an=0;
+        int an=0;
         for (int i=0;i<ncv;i++){
             if (cv[i].suit==s){
                 if (cv[i].rank>=15) continue; /* 2(15)/Joker(16) は階段不可 */
@@ -142,9 +157,10 @@ static int pick_min_straight_from_view(const CardView* cv, int ncv, u8 need_top_
 }
 
 /* 先出し：複数枚（4→3→2）を優先、なければ単体、最後に階段 */
-static int pick_lead_pref_multi_from_view(const CardView* cv, int ncv, const FieldState* fs,
+IWRAM_CODE
+static int pick_lead_pref_multi_from_view(const CardView* cv, int ncv, const FieldState* fs, AiWork* w,
                                           u8 out_cards[4], u8* out_n){
-    CardView tmp[20];
+    CardView* tmp = w->sorted;
     for (int i=0;i<ncv;i++) cv_copy(&tmp[i], &cv[i]);
     sort_by_eff_rank(tmp, ncv);
 
@@ -166,19 +182,20 @@ static int pick_lead_pref_multi_from_view(const CardView* cv, int ncv, const Fie
 
     /* 最後に階段（最低 STRAIGHT_MIN） */
     for (int need_len=4; need_len>=STRAIGHT_MIN; --need_len){
-        if (pick_min_straight_from_view(cv,ncv,0,need_len,fs,out_cards,out_n)) return 1;
+        if (pick_min_straight_from_view(cv,ncv,0,need_len,fs,w,out_cards,out_n)) return 1;
     }
     return 0;
 }
 
 /* 後追い：場の形に合わせて最小勝ち（単体/セット/階段） */
+IWRAM_CODE
 static int pick_follow_minwin_from_view(const CardView* cv, int ncv,
-                                        const FieldState* fs, const u8 have[17],
+                                        const FieldState* fs, const u8 have[17], AiWork* w,
                                         u8 out_cards[4], u8* out_n){
     if (fs->field_is_straight){
         int need_len = fs->field_count;
         u8 need_top_eff = fs->field_eff_rank;
-        if (pick_min_straight_from_view(cv,ncv,need_top_eff,need_len,fs,out_cards,out_n)) return 1;
+        if (pick_min_straight_from_view(cv,ncv,need_top_eff,need_len,fs,w,out_cards,out_n)) return 1;
         return 0;
     }
 
@@ -208,16 +225,23 @@ static int pick_follow_minwin_from_view(const CardView* cv, int ncv,
 }
 
 /* ---- 公開API ---- */
+IWRAM_CODE
 int ai_choose_move_group(const Hand* hand, const FieldState* fs, u8 out_cards[4], u8* out_n){
-    CardView cv[20];
+    ArenaMark mark = arena_mark(ARENA_FRAME);
+    AiWork* w = (AiWork*)arena_alloc(ARENA_FRAME, sizeof(AiWork));   /* 足りなければ arena が止める */
+
+    CardView* cv = w->view;
     int ncv=0;
     build_card_view(hand, fs->revolution, fs->jback_active, cv, &ncv);
 
     u8 have[17]; build_histogram_from_view(cv,ncv,have);
 
+    int r;
     if (!fs->field_visible || fs->field_count==0){
-        return pick_lead_pref_multi_from_view(cv,ncv,fs,out_cards,out_n);
+        r = pick_lead_pref_multi_from_view(cv,ncv,fs,w,out_cards,out_n);
     }else{
-        return pick_follow_minwin_from_view(cv,ncv,fs,have,out_cards,out_n);
+        r = pick_follow_minwin_from_view(cv,ncv,fs,have,w,out_cards,out_n);
     }
+    arena_release(ARENA_FRAME, mark);
+    return r;
 }
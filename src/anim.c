@@ -0,0 +1,126 @@
+#include "anim.h"
+#include "oam.h"
+#include "sprite_bare.h"
+
+/* ================= テーブル ================= */
+
+/* easing：t=0..1 を 32 分割した Q8 値（端点込み 33 点） */
+static const u16 kEase[ANIM_EASE_COUNT][33] = {
+  { 0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128,
+    136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248, 256 },
+  { 0, 16, 31, 46, 60, 74, 87, 100, 112, 124, 135, 146, 156, 166, 175, 184, 192,
+    200, 207, 214, 220, 226, 231, 236, 240, 244, 247, 250, 252, 254, 255, 256, 256 },
+  { 0, 1, 3, 6, 11, 17, 24, 31, 40, 49, 59, 70, 81, 92, 104, 116, 128,
+    140, 152, 164, 175, 186, 197, 207, 216, 225, 232, 239, 245, 250, 253, 255, 256 },
+};
+
+/* sin の 1/4 周期（角度 0..64 / 1周=256, Q8） */
+static const u16 kSinQ8[65] = {
+  0, 6, 13, 19, 25, 31, 38, 44, 50, 56, 62, 68, 74, 80, 86, 92, 98,
+  104, 109, 115, 121, 126, 132, 137, 142, 147, 152, 157, 162, 167, 172, 177, 181,
+  185, 190, 194, 198, 202, 206, 209, 213, 216, 220, 223, 226, 229, 231, 234, 237,
+  239, 241, 243, 245, 247, 248, 250, 251, 252, 253, 254, 255, 255, 256, 256, 256,
+};
+
+static inline s32 sin_q8_(u8 a){
+  u32 i = a & 63;
+  switch (a >> 6){
+    case 0:  return  (s32)kSinQ8[i];
+    case 1:  return  (s32)kSinQ8[64 - i];
+    case 2:  return -(s32)kSinQ8[i];
+    default: return -(s32)kSinQ8[64 - i];
+  }
+}
+
+/* ================= 内部状態 ================= */
+
+typedef struct {
+    u32 t;                   /* 進行度 Q16（0x10000 で終点） */
+    u32 step;                /* 1フレームの増分（frames=1 なら 0x10000 なので u16 に入らない） */
+    s16 x0, y0, dx, dy;      /* 始点と移動量 */
+    u16 attr0, attr1, attr2;
+    u8  cx, cy;              /* 中心（w/2, h/2） */
+    u8  ease, tag, flags;
+    s8  user;
+    u8  active;
+} Tween;
+
+static Tween s_tw[ANIM_MAX];
+
+/* =============== 公開 API =============== */
+
+void anim_reset(void){
+  for (int i=0;i<ANIM_MAX;++i) s_tw[i].active = 0;
+}
+
+int anim_spawn(const AnimDesc* d){
+  if (!d) return -1;
+  for (int i=0;i<ANIM_MAX;++i){
+    Tween* w = &s_tw[i];
+    if (w->active) continue;
+    u32 frames = d->frames ? d->frames : 1;
+    w->t      = 0;
+    w->step   = 0x10000u / frames;          /* 除算はここだけ */
+    w->x0     = d->x0;  w->y0 = d->y0;
+    w->dx     = (s16)(d->x1 - d->x0);
+    w->dy     = (s16)(d->y1 - d->y0);
+    w->attr0  = d->attr0; w->attr1 = d->attr1; w->attr2 = d->attr2;
+    w->cx     = (u8)(d->w >> 1); w->cy = (u8)(d->h >> 1);
+    w->ease   = (d->ease < ANIM_EASE_COUNT) ? d->ease : ANIM_EASE_LINEAR;
+    w->tag    = d->tag;
+    w->user   = d->user;
+    w->flags  = d->flags;
+    w->active = 1;
+    return i;
+  }
+  return -1;
+}
+
+void anim_update(void){
+  for (int i=0;i<ANIM_MAX;++i){
+    Tween* w = &s_tw[i];
+    if (!w->active) continue;
+
+    /* 前フレームで終点を描いたものはここで終了 */
+    if (w->t >= 0x10000u){ w->active = 0; continue; }
+    w->t += w->step;
+    if (w->t > 0x10000u) w->t = 0x10000u;
+
+    /* easing（33点テーブルの線形補間, Q8） */
+    u32 k = w->t >> 11, f = (w->t >> 3) & 0xFF;
+    const u16* lut = kEase[w->ease];
+    s32 e = (k >= 32) ? lut[32] : (s32)lut[k] + ((((s32)lut[k+1] - (s32)lut[k]) * (s32)f) >> 8);
+
+    s32 x = w->x0 + ((w->dx * e) >> 8);
+    s32 y = w->y0 + ((w->dy * e) >> 8);
+
+    u16* oo = oam_alloc(OAM_LAYER_ANIM);
+    if (!oo) continue;
+
+    if (w->flags & ANIM_F_SPIN){
+      /* アフィン（倍角表示）：行列はトゥイーン番号をそのまま使う */
+      u8  a = (u8)e;                       /* 0..256 → 1回転 */
+      s32 s = sin_q8_(a), c = sin_q8_((u8)(a + 64));
+      oam_set_affine(i, (s16)c, (s16)-s, (s16)s, (s16)c);
+      x -= w->cx; y -= w->cy;              /* 倍角の分だけ左上へずらす */
+      oo[0] = ATTR0_Y(y) | ATTR0_AFFINE | ATTR0_DOUBLE | w->attr0;
+      oo[1] = ATTR1_X(x) | ATTR1_AFFINE_IDX(i) | w->attr1;
+    }else{
+      oo[0] = ATTR0_Y(y) | ATTR0_MODE_REG | w->attr0;
+      oo[1] = ATTR1_X(x) | w->attr1;
+    }
+    oo[2] = w->attr2;
+  }
+}
+
+int anim_count(int tag, int user){
+  int n = 0;
+  for (int i=0;i<ANIM_MAX;++i){
+    const Tween* w = &s_tw[i];
+    if (!w->active) continue;
+    if (tag != ANIM_TAG_NONE && w->tag != tag) continue;
+    if (user >= 0 && w->user != user) continue;
+    n++;
+  }
+  return n;
+}
@@ -0,0 +1,95 @@
+#include "arena.h"
+#include "sprite_bare.h"
+#include <stdint.h>
+#ifdef HOST_BUILD
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+/* ================= 内部状態 ================= */
+
+static u8* s_base = NULL;
+static u32 s_cap  = 0;
+static u32 s_used[ARENA_SCOPE_COUNT];   /* ARENA_TURN は先頭から、ARENA_FRAME は末尾から */
+static ArenaStats s_stats;
+
+/* ================= 内部ヘルパ ================= */
+
+/* 取り置き不足：その場で止める。実機は画面を背景色（赤）だけにして割り込みも止めて眠る */
+__attribute__((noreturn)) static void fail_(u32 bytes){
+  s_stats.failures++;
+#ifdef HOST_BUILD
+  fprintf(stderr, "arena: out of memory (%u bytes, capacity %u, used %u+%u)\n",
+          (unsigned)bytes, (unsigned)s_cap, (unsigned)s_used[ARENA_TURN], (unsigned)s_used[ARENA_FRAME]);
+  abort();
+#else
+  (void)bytes;
+  REG_IME = 0;
+  REG_DISPCNT = DCNT_MODE0;     /* BG も OBJ も出さない → 全面がバックドロップ色 */
+  BG_PAL16[0] = 0x001F;         /* 赤 */
+  for (;;) __asm__ volatile("swi 0x02");   /* Halt（割り込み禁止なので起きない） */
+#endif
+}
+
+static void note_(int scope){
+  u32 u = s_used[scope];
+  s_stats.used[scope] = u;
+  if (u > s_stats.peak[scope]) s_stats.peak[scope] = u;
+  u32 all = s_used[ARENA_TURN] + s_used[ARENA_FRAME];
+  if (all > s_stats.high_water) s_stats.high_water = all;
+}
+
+/* =============== 公開 API =============== */
+
+void arena_init(void* base, u32 bytes){
+  u8* p   = (u8*)base;
+  if (!p) fail_(bytes);
+  u32 pad = (u32)(-(uintptr_t)p & 3u);
+  s_base = p ? p + pad : NULL;
+  s_cap  = (p && bytes > pad) ? (bytes - pad) & ~3u : 0;
+  s_stats.capacity = s_cap;
+  s_stats.high_water = s_stats.failures = 0;
+  for (int i=0;i<ARENA_SCOPE_COUNT;++i){
+    s_used[i] = 0;
+    s_stats.used[i] = s_stats.peak[i] = 0;
+  }
+}
+
+void* arena_alloc(int scope, u32 bytes){
+  if ((unsigned)scope >= ARENA_SCOPE_COUNT) return NULL;
+  bytes = (bytes + 3u) & ~3u;
+  u32 room = s_cap - s_used[ARENA_TURN] - s_used[ARENA_FRAME];
+  if (!s_base || bytes > room) fail_(bytes);
+  void* p;
+  if (scope == ARENA_TURN){
+    p = s_base + s_used[ARENA_TURN];
+    s_used[ARENA_TURN] += bytes;
+  }else{
+    s_used[ARENA_FRAME] += bytes;
+    p = s_base + s_cap - s_used[ARENA_FRAME];
+  }
+  note_(scope);
+  return p;
+}
+
+ArenaMark arena_mark(int scope){
+  if ((unsigned)scope >= ARENA_SCOPE_COUNT) return 0;
+  return s_used[scope];
+}
+
+void arena_release(int scope, ArenaMark mark){
+  if ((unsigned)scope >= ARENA_SCOPE_COUNT) return;
+  if (mark < s_used[scope]){
+    s_used[scope] = mark;
+    s_stats.used[scope] = mark;
+  }
+}
+
+void arena_reset(int scope){
+  arena_release(scope, 0);
+}
+
+void arena_get_stats(ArenaStats* out){
+  if (!out) return;
+  *out = s_stats;
+}
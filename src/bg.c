@@ -4,89 +4,39 @@
 //
 //	bg, 256x160@4,
 //	+ palette 16 entries, not compressed
-//	+ tiles (t|f|p reduced) not compressed
-//	+ regular map (flat), not compressed, 32x20
-//	Total size: 32 + 832 + 1280 = 2144
+//	+ tiles (t|f|p reduced) lz77 compressed
+//	+ sparse map (fill + spans), 32x20
+//	Total size: 32 + 188 + 82 = 302 (raw 2144)
 //
 //======================================================================
 
 #include "bg.h"
 
-const unsigned int bgTiles[208] __attribute__((aligned(4))) =
+const unsigned int bgTilesLZ[47] __attribute__((aligned(4), section(".initdata"))) =
 {
-    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00000000,0x00000000,0x00000000,0x00111100,0x01100010,0x01100011,0x00000011,0x01100011,
-    0x00000000,0x00000000,0x00000000,0x01111100,0x11001100,0x11001100,0x01111100,0x00001100,
-    0x00000000,0x00000000,0x00000000,0x10011000,0x10011000,0x10011000,0x10011000,0x10011000,
-    0x00000000,0x00000000,0x00000000,0x11000001,0x11100001,0x11000001,0x11000001,0x11000001,
-    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x10000000,0x10000000,
-    0x00000000,0x00000000,0x00000000,0x00011110,0x00110001,0x00110001,0x00000001,0x00110001,
-    0x00000000,0x00000000,0x00000000,0x00111110,0x01100110,0x01100110,0x00111110,0x00000110,
-    0x00000000,0x00000000,0x00000000,0x11001100,0x11001100,0x11001100,0x11001100,0x11001100,
-    0x00000000,0x00000000,0x00000000,0x11100000,0x10010000,0x10000000,0x11000000,0x01100000,
-    0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000001,0x00000000,0x00000000,
-    0x00000000,0x00000000,0x00000000,0x11000001,0x00100001,0x00000001,0x11000001,0x00000001,
-    0x00000000,0x00000000,0x00000000,0x00000001,0x00000011,0x00000011,0x00000001,0x00000011,
-    0x01100011,0x00111100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00001100,0x00001100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x11110000,0x01100000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x11000000,0x11100000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00110001,0x00011110,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00000110,0x00000110,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x01111000,0x00110000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00110000,0x11110000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00100000,0x11000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-    0x00000011,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00034010,0xF000003E,0xF001F001,0x0001F001,0x11031101,0x10001000,0x00050001,0x0E00EF03,
+    0x1FC00700,0x40140001,0xB00B2001,0x01103E3F,0x03B03E10,0x4C001E80,0xFF103400,0x07100300,
+    0x84F00330,0x03804930,0x31001470,0x307410F5,0xB04F1003,0xBF10103E,0xFF014001,0xDFD00B20,
+    0x76C001F0,0xB3200F00,0x0B000310,0x4041E0FF,0x80B0F077,0x102350DF,0x313BE0DF,0x0B90FF57,
+    0xAB006300,0xB3604DF0,0xB4D125F1,0xC0FFA7F0,0xF0D71041,0xF0979001,0xF08BA101,0xFF3B6001,
+    0xE9E0C100,0x9DF01292,0x06F272C1,0x20F000F1,0xF09EB0F8,0xF03D801F,0x0001707E,
 };
 
-const unsigned short bgMap[640] __attribute__((aligned(4))) =
+unsigned int bgTiles[208] __attribute__((aligned(4), section(".initbss")));
+
+const unsigned short bgMapSparse[41] __attribute__((aligned(4))) =
 {
-    0x0001,0x0001,0x0001,0x0002,0x0003,0x0004,0x0005,0x0001,0x0001,0x0001,0x0001,0x0001,0x0006,0x0007,0x0008,0x0009,
-    0x000A,0x000B,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0003,0x0004,0x000C,0x000D,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x000E,0x000F,0x0010,0x0011,0x0012,0x0001,0x0001,0x0001,0x0001,0x0013,0x0014,0x0015,0x0016,
-    0x0017,0x0012,0x0001,0x0001,0x0001,0x0001,0x0001,0x000E,0x000F,0x0010,0x0018,0x0019,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
-    0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
+    0x0001,0x0000,0x141E,0x0006,0x0C03,0x0002,0x0003,0x0004,
+    0x0005,0x140C,0x0006,0x0007,0x0008,0x0009,0x000A,0x000B,
+    0x1017,0x0002,0x0003,0x0004,0x000C,0x000D,0x1023,0x000E,
+    0x000F,0x0010,0x0011,0x0012,0x142C,0x0013,0x0014,0x0015,
+    0x0016,0x0017,0x0012,0x1037,0x000E,0x000F,0x0010,0x0018,
+    0x0019,
 };
 
-const unsigned short bgPal[16] __attribute__((aligned(4))) =
+unsigned short bgMap[640] __attribute__((aligned(4), section(".initbss")));
+
+const unsigned short bgPal[16] __attribute__((aligned(4), section(".initdata"))) =
 {
     0x36CE,0x7FFF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
 };
@@ -0,0 +1,186 @@
+#include "bgmap.h"
+#include "sprite_bare.h"
+#include "dmaq.h"
+#include "lz77.h"
+
+/* ================= 内部状態 ================= */
+
+static u16  s_map[BGMAP_COLS * BGMAP_ROWS] __attribute__((aligned(4)));  /* 転送元シャドウ */
+static const u16* s_base_map = NULL;     /* 元の背景（restore 用） */
+static const u16* s_base_sparse = NULL;  /* 同、疎マップで持つ場合 */
+static u8*  s_char_base   = NULL;        /* BG0 のキャラ先頭 */
+static u16* s_screen_base = NULL;        /* BG0 のスクリーン先頭 */
+static int  s_next_tile   = 0;
+static int  s_tile_limit  = 0;           /* スクリーンブロックと重ならない上限 */
+static u32  s_dirty_rows  = 0;           /* bit y = 行 y に変更あり */
+static BgMapStats s_stats;
+
+/* ================= 内部ヘルパ ================= */
+
+#define SPAN_X(h)    ((h) & 31)
+#define SPAN_Y(h)    (((h) >> 5) & 31)
+#define SPAN_LEN(h)  ((((h) >> 10) & 31) + 1)
+#define SPAN_RUN(h)  ((h) & 0x8000)
+
+static int in_fill_(const u16* sp, int x, int y){
+  int fx = sp[1] & 0xFF, fy = sp[1] >> 8;
+  return x >= fx && x < fx + (sp[2] & 0xFF) && y >= fy && y < fy + (sp[2] >> 8);
+}
+
+/* 疎マップの (x,y) のエントリ。スパンは数本なので先頭から舐める */
+static u16 sparse_get_(const u16* sp, int x, int y){
+  u16 e = in_fill_(sp, x, y) ? sp[0] : 0;
+  const u16* p = sp + 4;
+  for (int n = sp[3]; n; --n){
+    u16 h = *p++;
+    int sx = SPAN_X(h), len = SPAN_LEN(h);
+    if (SPAN_Y(h) == y && x >= sx && x < sx + len) e = SPAN_RUN(h) ? p[0] : p[x - sx];
+    p += SPAN_RUN(h) ? 1 : len;
+  }
+  return e;
+}
+
+static u16 base_entry_(int x, int y){
+  if (s_base_sparse) return sparse_get_(s_base_sparse, x, y);
+  return s_base_map ? s_base_map[y * BGMAP_COLS + x] : 0;
+}
+
+/* ERAPI_LoadBackgroundCustom が置く BG0 の配置（キャラ 0 / スクリーン 31）。
+   BG0CNT が読み込み直後にまだ 0 のまま（次の RenderFrame で反映）の時はこれを使う */
+#define BG0CNT_ERAPI_DEFAULT  ((u16)(31u << 8))
+
+static void init_regs_(int first_free_tile){
+  u16 cnt = REG_IO16(REG_OFS_BG0CNT);
+  /* スクリーン 0 はキャラ 0 と重なるので、読み込んだ背景の配置としてはありえない */
+  if (BGCNT_SCREEN_BASE(cnt) == 0) cnt = BG0CNT_ERAPI_DEFAULT;
+  u32 char_ofs   = BGCNT_CHAR_BASE(cnt)   * 0x4000u;
+  u32 screen_ofs = BGCNT_SCREEN_BASE(cnt) * 0x800u;
+
+  s_char_base   = (u8*) BG_VRAM8 + char_ofs;
+  s_screen_base = (u16*)(BG_VRAM8 + screen_ofs);
+  s_next_tile   = first_free_tile;
+
+  /* キャラは 1024 枚まで。スクリーンが後ろにあればそこで止める */
+  u32 end = 0x10000u;
+  if (screen_ofs > char_ofs && screen_ofs < end) end = screen_ofs;
+  s_tile_limit = (int)((end - char_ofs) / 32);
+  if (s_tile_limit > 1024) s_tile_limit = 1024;
+
+  s_dirty_rows = 0;
+  s_stats.entry_writes = s_stats.entry_skips = s_stats.rows_flushed = 0;
+}
+
+/* =============== 公開 API =============== */
+
+void bgmap_sparse_expand(const u16* sp, u16* out){
+  for (int y=0;y<BGMAP_ROWS;++y)
+    for (int x=0;x<BGMAP_COLS;++x)
+      out[y * BGMAP_COLS + x] = in_fill_(sp, x, y) ? sp[0] : 0;
+
+  const u16* p = sp + 4;
+  for (int n = sp[3]; n; --n){
+    u16 h = *p++;
+    int x = SPAN_X(h), y = SPAN_Y(h), len = SPAN_LEN(h);
+    if (y >= BGMAP_ROWS || x + len > BGMAP_COLS){ p += SPAN_RUN(h) ? 1 : len; continue; }
+    u16* d = &out[y * BGMAP_COLS + x];
+    if (SPAN_RUN(h)){ for (int i=0;i<len;++i) d[i] = p[0]; p += 1; }
+    else            { for (int i=0;i<len;++i) d[i] = p[i]; p += len; }
+  }
+}
+
+void bgmap_init(const u16* base_map, int first_free_tile){
+  init_regs_(first_free_tile);
+  s_base_map    = base_map;
+  s_base_sparse = NULL;
+  for (int i=0;i<BGMAP_COLS * BGMAP_ROWS;++i) s_map[i] = base_map ? base_map[i] : 0;
+}
+
+void bgmap_init_sparse(const u16* sparse, int first_free_tile){
+  init_regs_(first_free_tile);
+  s_base_map    = NULL;
+  s_base_sparse = sparse;
+  bgmap_sparse_expand(sparse, s_map);
+}
+
+int bgmap_alloc_tiles(const void* tiles, int count){
+  if (!s_char_base || count <= 0) return -1;
+  if (s_next_tile + count > s_tile_limit) return -1;
+  int t = s_next_tile;
+  if (!dmaq_push(s_char_base + t * 32, tiles, (u32)count * 8, DMAQ_PRIO_NORMAL)) return -1;
+  s_next_tile += count;
+  return t;
+}
+
+int bgmap_alloc_tiles_lz(const void* lz, int count, const char* name){
+  if (!s_char_base || count <= 0) return -1;
+  if (s_next_tile + count > s_tile_limit) return -1;
+  int t = s_next_tile;
+  if (!dmaq_push_fill(s_char_base + t * 32, lz77_fill_vram, lz, name, (u32)count * 8, DMAQ_PRIO_NORMAL)) return -1;
+  s_next_tile += count;
+  return t;
+}
+
+int bgmap_alloc_tiles_indexed(const void* tiles, const u8* index, int count){
+  if (!s_char_base || count <= 0) return -1;
+  if (s_next_tile + count > s_tile_limit) return -1;
+  int t = s_next_tile;
+  if (!dmaq_push_tiles(s_char_base + t * 32, tiles, index, (u32)count, DMAQ_PRIO_NORMAL)) return -1;
+  s_next_tile += count;
+  return t;
+}
+
+void bgmap_set(int x, int y, u16 entry){
+  if ((unsigned)x >= BGMAP_COLS || (unsigned)y >= BGMAP_ROWS) return;
+  u16* e = &s_map[y * BGMAP_COLS + x];
+  if (*e == entry){ s_stats.entry_skips++; return; }
+  *e = entry;
+  s_dirty_rows |= 1u << y;
+  s_stats.entry_writes++;
+}
+
+void bgmap_restore(int x, int y){
+  if ((unsigned)x >= BGMAP_COLS || (unsigned)y >= BGMAP_ROWS) return;
+  bgmap_set(x, y, base_entry_(x, y));
+}
+
+void bgmap_restore_rect(int x, int y, int w, int h){
+  for (int ty=y; ty<y+h; ++ty)
+    for (int tx=x; tx<x+w; ++tx) bgmap_restore(tx, ty);
+}
+
+void bgmap_apply_sparse(const u16* patch){
+  int fx = patch[1] & 0xFF, fy = patch[1] >> 8;
+  int fw = patch[2] & 0xFF, fh = patch[2] >> 8;
+  for (int y=fy; y<fy+fh; ++y)
+    for (int x=fx; x<fx+fw; ++x) bgmap_set(x, y, patch[0]);
+
+  const u16* p = patch + 4;
+  for (int n = patch[3]; n; --n){
+    u16 h = *p++;
+    int x = SPAN_X(h), y = SPAN_Y(h), len = SPAN_LEN(h);
+    for (int i=0;i<len;++i) bgmap_set(x + i, y, SPAN_RUN(h) ? p[0] : p[i]);
+    p += SPAN_RUN(h) ? 1 : len;
+  }
+}
+
+void bgmap_commit(void){
+  if (!s_dirty_rows || !s_screen_base) return;
+  /* 連続した変更行は1コマンドにまとめる */
+  int y = 0;
+  while (y < BGMAP_ROWS){
+    if (!(s_dirty_rows & (1u << y))){ ++y; continue; }
+    int y0 = y;
+    while (y < BGMAP_ROWS && (s_dirty_rows & (1u << y))) ++y;
+    u32 words = (u32)(y - y0) * (BGMAP_COLS / 2);
+    dmaq_push(s_screen_base + y0 * BGMAP_COLS, &s_map[y0 * BGMAP_COLS], words, DMAQ_PRIO_HIGH);
+    s_stats.rows_flushed += (u32)(y - y0);
+  }
+  s_dirty_rows = 0;
+}
+
+void bgmap_get_stats(BgMapStats* out){
+  if (!out) return;
+  out->entry_writes = s_stats.entry_writes;
+  out->entry_skips  = s_stats.entry_skips;
+  out->rows_flushed = s_stats.rows_flushed;
+}
@@ -0,0 +1,89 @@
+#include "blend.h"
+#include "hwstate.h"
+#include "sprite_bare.h"
+
+/* ================= 内部状態 ================= */
+
+typedef struct {
+    u8 level;        /* 現在値 0..16 */
+    u8 target;       /* 目標値 */
+    u8 period;       /* 何フレームで1段動かすか */
+    u8 timer;
+} Ramp;
+
+static Ramp s_fade;          /* 画面全体の黒フェード */
+static Ramp s_dim;           /* 卓の減光 */
+static Ramp s_alpha;         /* 半透明 OBJ の濃さ */
+
+/* ================= 内部ヘルパ ================= */
+
+static void ramp_set_(Ramp* r, int level, int target, int period){
+  if (target < 0) target = 0;
+  if (target > BLEND_LEVEL_MAX) target = BLEND_LEVEL_MAX;
+  if (period < 1) period = 1;
+  if (level >= 0) r->level = (u8)((level > BLEND_LEVEL_MAX) ? BLEND_LEVEL_MAX : level);
+  r->target = (u8)target;
+  r->period = (u8)period;
+  r->timer  = 0;
+}
+
+static void ramp_step_(Ramp* r){
+  if (r->level == r->target) return;
+  if (++r->timer < r->period) return;
+  r->timer = 0;
+  if (r->level < r->target) r->level++; else r->level--;
+}
+
+/* =============== 公開 API =============== */
+
+void blend_init(void){
+  ramp_set_(&s_fade,  0, 0, 1);
+  ramp_set_(&s_dim,   0, 0, 1);
+  ramp_set_(&s_alpha, 0, 0, 1);
+}
+
+void blend_fade_in(int frames_per_step){
+  ramp_set_(&s_fade, BLEND_LEVEL_MAX, 0, frames_per_step);
+}
+
+void blend_fade_out(int frames_per_step){
+  ramp_set_(&s_fade, -1, BLEND_LEVEL_MAX, frames_per_step);
+}
+
+int blend_fade_busy(void){
+  return s_fade.level != s_fade.target;
+}
+
+void blend_set_dim(int on){
+  int t = on ? BLEND_DIM_LEVEL : 0;
+  if (s_dim.target != t) ramp_set_(&s_dim, -1, t, 1);
+}
+
+void blend_set_obj_alpha(int target){
+  if (s_alpha.target != target) ramp_set_(&s_alpha, -1, target, 1);
+}
+
+int blend_obj_alpha(void){
+  return s_alpha.level;
+}
+
+void blend_update(void){
+  ramp_step_(&s_fade);
+  ramp_step_(&s_dim);
+  ramp_step_(&s_alpha);
+
+  /* 半透明 OBJ の合成相手はいつも BG0 と背景色（BLDCNT のモードに関係なく効く） */
+  u16 cnt = BLD_BOT(BLD_BG0 | BLD_BD);
+  u16 y   = 0;
+  if (s_fade.level){
+    cnt |= BLD_TOP(BLD_ALL) | BLD_MODE_BLACK;
+    y    = s_fade.level;
+  }else if (s_dim.level){
+    cnt |= BLD_TOP(BLD_BG0 | BLD_BD) | BLD_MODE_BLACK;
+    y    = s_dim.level;
+  }
+
+  hw_reg16_set(REG_OFS_BLDCNT,   cnt);
+  hw_reg16_set(REG_OFS_BLDALPHA, BLDALPHA_SET(s_alpha.level, BLEND_LEVEL_MAX - s_alpha.level));
+  hw_reg16_set(REG_OFS_BLDY,     y);
+}
@@ -0,0 +1,32 @@
+#include "card_glyphs.h"
+
+const unsigned char cardGlyphTplRow[32] = { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1 };
+const unsigned int cardGlyphTplWords[2][2] __attribute__((aligned(4))) = {
+  { 0x11111111, 0x01111111 },
+  { 0x00000000, 0x00000000 },
+};
+
+const unsigned char cardGlyphRank[13][7] = {
+  { 0x02,0x03,0x02,0x02,0x02,0x02,0x07 }, /* 1 */
+  { 0x06,0x09,0x08,0x04,0x02,0x01,0x0F }, /* 2 */
+  { 0x06,0x09,0x08,0x06,0x08,0x09,0x06 }, /* 3 */
+  { 0x05,0x05,0x05,0x0F,0x04,0x04,0x04 }, /* 4 */
+  { 0x0F,0x01,0x01,0x07,0x08,0x09,0x06 }, /* 5 */
+  { 0x06,0x09,0x01,0x07,0x09,0x09,0x06 }, /* 6 */
+  { 0x0F,0x09,0x08,0x08,0x08,0x08,0x08 }, /* 7 */
+  { 0x06,0x09,0x09,0x06,0x09,0x09,0x06 }, /* 8 */
+  { 0x06,0x09,0x09,0x0E,0x08,0x09,0x06 }, /* 9 */
+  { 0x62,0x93,0x92,0x92,0x92,0x92,0x67 }, /* 10 */
+  { 0x08,0x08,0x08,0x08,0x08,0x09,0x06 }, /* 11 */
+  { 0x06,0x09,0x09,0x0B,0x0D,0x09,0x16 }, /* 12 */
+  { 0x09,0x09,0x05,0x03,0x05,0x09,0x09 }, /* 13 */
+};
+
+const unsigned short cardGlyphPip[4][10] = {
+  { 0x0000,0x0C60,0x1EF0,0x1FF0,0x1FF0,0x1FF0,0x0FE0,0x07C0,0x0380,0x0100 }, /* H */
+  { 0x0100,0x0380,0x07C0,0x0FE0,0x1FF0,0x1FF0,0x0FE0,0x07C0,0x0380,0x0100 }, /* D */
+  { 0x0100,0x0380,0x07C0,0x0FE0,0x1FF0,0x1FF0,0x0D60,0x0100,0x0380,0x06C0 }, /* S */
+  { 0x01C0,0x03E0,0x03E0,0x0DD8,0x1EBC,0x1FFC,0x1EBC,0x0C98,0x01C0,0x0360 }, /* C */
+};
+
+const unsigned char cardGlyphInk[4] = { 3,3,2,2 };
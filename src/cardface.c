@@ -0,0 +1,65 @@
+#include "cardface.h"
+#include "card_glyphs.h"
+#include "cards.h"
+#include "dmaq.h"
+#include "sprite_bare.h"
+
+/* ================= 内部ヘルパ ================= */
+
+/* 1bpp の 4 画素 → 各ニブルの bit0（左=下位ニブル） */
+static const u16 kNibble[16] = {
+  0x0000, 0x0001, 0x0010, 0x0011, 0x0100, 0x0101, 0x0110, 0x0111,
+  0x1000, 0x1001, 0x1010, 0x1011, 0x1100, 0x1101, 0x1110, 0x1111,
+};
+
+static inline u32 spread8_(u32 m){
+  return kNibble[m & 15] | ((u32)kNibble[(m >> 4) & 15] << 16);
+}
+
+/* 絵札の番号（スプライト名 X_1..X_13 の 1..13）→ 字形 0..12 */
+static int glyph_of_(u8 card){
+  u8 r = CARD_RANK(card);
+  if (r == 14) return 0;          /* A */
+  if (r == 15) return 1;          /* 2 */
+  return r - 1;                   /* 3..13 */
+}
+
+/* src = ランク字形の行, aux = スートの行。VRAM は 8bit 書き込み不可なので 1 行 1 ワードで書く */
+static void expand_(void* dst, const void* src, const void* aux, u32 words){
+  const u8*  rank = (const u8*)src;
+  const u16* pip  = (const u16*)aux;
+  u32 ink = cardGlyphInk[(pip - cardGlyphPip[0]) / CARDGLYPH_PIP_H];
+  vu32* d = (vu32*)dst;
+  (void)words;
+
+  for (int y=0; y<32; ++y){
+    const u32* t = (const u32*)cardGlyphTplWords[cardGlyphTplRow[y]];
+    u32 m = 0;
+    if ((unsigned)(y - CARDGLYPH_RANK_Y) < CARDGLYPH_RANK_H) m  = (u32)rank[y - CARDGLYPH_RANK_Y] << CARDGLYPH_RANK_X;
+    if ((unsigned)(y - CARDGLYPH_PIP_Y)  < CARDGLYPH_PIP_H)  m |= pip[y - CARDGLYPH_PIP_Y];
+    u32 l = spread8_(m), r = spread8_(m >> 8);
+    vu32* row = d + (y >> 3) * 16 + (y & 7);        /* 16x32 は 2 タイル/行 */
+    row[0] = (t[0] & ~(l * 15)) | (l * ink);
+    row[8] = (t[1] & ~(r * 15)) | (r * ink);
+  }
+#ifdef HOST_BUILD
+  hostmem_count(dst, CARDFACE_TILES * 32);
+#endif
+}
+
+/* =============== 公開 API =============== */
+
+int cardface_supported(u8 card){
+  return !CARD_IS_JOKER(card);
+}
+
+u16 cardface_push(void* dst, u8 card, int prio){
+  if (!cardface_supported(card)) return 0;
+  return dmaq_push_fill(dst, expand_, cardGlyphRank[glyph_of_(card)], cardGlyphPip[CARD_SUIT(card)],
+                        CARDFACE_TILES * 8, prio);
+}
+
+void cardface_expand(void* dst, u8 card){
+  if (!cardface_supported(card)) return;
+  expand_(dst, cardGlyphRank[glyph_of_(card)], cardGlyphPip[CARD_SUIT(card)], CARDFACE_TILES * 8);
+}
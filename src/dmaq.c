@@ -0,0 +1,155 @@
+#include "dmaq.h"
+#include "sprite_bare.h"
+
+/* ================= 内部状態 ================= */
+
+typedef struct {
+    void*       dst;
+    const void* src;
+    const void* aux;
+    DmaqFillFn  fill;    /* 非 NULL なら DMA の代わりに呼ぶ（タイル集め・展開） */
+    u32         words;
+    u16         ticket;
+    u8          prio;
+} DmaCmd;
+
+static DmaCmd s_cmds[DMAQ_MAX_CMDS];   /* 積んだ順（同一優先度内は FIFO） */
+static int    s_ncmds  = 0;
+static u16    s_ticket = 0;
+static u32    s_budget = DMAQ_DEFAULT_BUDGET;
+static DmaqStats s_stats;
+
+/* 0 はチケット無しを表すので飛ばす */
+static u16 next_ticket_(void){
+  if (++s_ticket == 0) s_ticket = 1;
+  return s_ticket;
+}
+
+/* タイル集め（src=タイルプール, aux=タイル番号列）：番号が連続する区間ごとに1本の DMA */
+static void copy_tiles_(void* dst, const void* tiles, const void* aux, u32 words){
+  const u8* index = (const u8*)aux;
+  u8*       d = (u8*)dst;
+  const u8* t = (const u8*)tiles;
+  u32 count = words / 8;
+  u32 i = 0;
+  while (i < count){
+    u32 run = 1;
+    while (i + run < count && index[i + run] == index[i] + run) run++;
+    spr_dma_copy32(d, t + index[i] * 32, run * 8);
+    d += run * 32;
+    i += run;
+  }
+}
+
+static u16 push_(void* dst, DmaqFillFn fill, const void* src, const void* aux, u32 words, int prio){
+  if (!dst || !src || words == 0) return 0;
+  if (prio < 0) prio = 0;
+  if (prio >= DMAQ_PRIO_COUNT) prio = DMAQ_PRIO_COUNT - 1;
+
+  /* 同じ転送先は後勝ちで統合（転送元も同じシャドウなら長い方を残す） */
+  for (int i=0;i<s_ncmds;++i){
+    DmaCmd* c = &s_cmds[i];
+    if (c->dst != dst) continue;
+    if (c->src != src || c->aux != aux || c->fill != fill || words > c->words) c->words = words;
+    c->src    = src;
+    c->aux    = aux;
+    c->fill   = fill;
+    if (prio < c->prio) c->prio = (u8)prio;
+    c->ticket = next_ticket_();
+    s_stats.coalesced++;
+    return c->ticket;
+  }
+
+  if (s_ncmds >= DMAQ_MAX_CMDS){
+    s_stats.dropped++;
+    return 0;
+  }
+  DmaCmd* c = &s_cmds[s_ncmds++];
+  c->dst    = dst;
+  c->src    = src;
+  c->aux    = aux;
+  c->fill   = fill;
+  c->words  = words;
+  c->prio   = (u8)prio;
+  c->ticket = next_ticket_();
+  return c->ticket;
+}
+
+/* =============== 公開 API =============== */
+
+u16 dmaq_push(void* dst, const void* src, u32 words, int prio){
+  return push_(dst, 0, src, 0, words, prio);
+}
+
+u16 dmaq_push_tiles(void* dst, const void* tiles, const u8* index, u32 count, int prio){
+  if (!index) return 0;
+  return push_(dst, copy_tiles_, tiles, index, count * 8, prio);
+}
+
+u16 dmaq_push_fill(void* dst, DmaqFillFn fill, const void* src, const void* aux, u32 words, int prio){
+  if (!fill) return 0;
+  return push_(dst, fill, src, aux, words, prio);
+}
+
+int dmaq_is_pending(u16 ticket){
+  if (ticket == 0) return 0;
+  for (int i=0;i<s_ncmds;++i) if (s_cmds[i].ticket == ticket) return 1;
+  return 0;
+}
+
+u32 dmaq_flush(void){
+  u32 bytes = 0, cmds = 0;
+
+  for (int p=0; p<DMAQ_PRIO_COUNT; ++p){
+    for (int i=0;i<s_ncmds;++i){
+      DmaCmd* c = &s_cmds[i];
+      if (c->prio != p || c->words == 0) continue;
+      u32 n = c->words * 4;
+      /* 予算超過は持ち越し（ただしそのフレーム最初の1本は必ず通す） */
+      if (cmds > 0 && bytes + n > s_budget) continue;
+      if (c->fill) c->fill(c->dst, c->src, c->aux, c->words);
+      else         spr_dma_copy32(c->dst, c->src, c->words);
+      bytes += n; cmds++;
+      c->words = 0;   /* 実行済み印 */
+    }
+  }
+
+  /* 未実行分を前詰め（順序は保つ） */
+  int w = 0;
+  for (int i=0;i<s_ncmds;++i){
+    if (s_cmds[i].words == 0) continue;
+    if (w != i){
+      s_cmds[w].dst    = s_cmds[i].dst;
+      s_cmds[w].src    = s_cmds[i].src;
+      s_cmds[w].aux    = s_cmds[i].aux;
+      s_cmds[w].fill   = s_cmds[i].fill;
+      s_cmds[w].words  = s_cmds[i].words;
+      s_cmds[w].ticket = s_cmds[i].ticket;
+      s_cmds[w].prio   = s_cmds[i].prio;
+    }
+    w++;
+  }
+  s_ncmds = w;
+
+  s_stats.last_bytes = bytes;
+  s_stats.last_cmds  = cmds;
+  s_stats.pending    = (u32)w;
+  if (bytes > s_stats.peak_bytes) s_stats.peak_bytes = bytes;
+  if (w > 0) s_stats.spilled_frames++;
+  return bytes;
+}
+
+void dmaq_set_budget(u32 bytes){
+  s_budget = bytes ? bytes : DMAQ_DEFAULT_BUDGET;
+}
+
+void dmaq_get_stats(DmaqStats* out){
+  if (!out) return;
+  out->last_bytes     = s_stats.last_bytes;
+  out->last_cmds      = s_stats.last_cmds;
+  out->peak_bytes     = s_stats.peak_bytes;
+  out->pending        = s_stats.pending;
+  out->spilled_frames = s_stats.spilled_frames;
+  out->coalesced      = s_stats.coalesced;
+  out->dropped        = s_stats.dropped;
+}
@@ -0,0 +1,164 @@
+#include "frame.h"
+#include "erapi.h"
+#include "dmaq.h"
+#include "hwstate.h"
+#include "prof.h"
+#include "sprite_bare.h"
+
+/* ================= 内部状態 ================= */
+
+typedef void (*IrqFn)(void);
+
+#define IRQ_VECTOR   (*(IrqFn volatile*)0x03007FFC)   /* BIOS が割り込みで呼ぶハンドラ */
+
+static volatile u32 s_vblanks;   /* 割り込みで数える */
+static volatile u8  s_commit;    /* 1 = 次の VBlank で dmaq を流す（割り込みが 0 に戻す） */
+static u32 s_seen;               /* 前回の frame_begin で見た s_vblanks */
+static u8  s_started;            /* 最初の frame_begin が済んだか（起動中の VBlank は数えない） */
+static u32 s_begin;              /* frame_begin の時刻（prof_now） */
+static FrameStats s_stats;
+
+/* 入口の後ろにつなぐ元のハンドラ（ファームウェア）。入口（アセンブラ）から読む。
+   C からは参照が見えないので、LTO（SIZE=1）で消されたり名前を変えられたりしないようにする */
+__attribute__((used, externally_visible)) IrqFn frame_irq_prev;
+__attribute__((used, externally_visible)) void  frame_on_vblank(void);
+
+/* ================= 割り込み ================= */
+
+/* BIOS から IRQ モード・ARM で呼ばれる（r0 = 0x04000000）。
+   IRQ スタックは小さいので、システムモードに切り替えてユーザースタックで C を呼ぶ（割り込みは禁止のまま）。
+   VBlank なら BIOS フラグ（0x03007FF8）の VBlank ビットはここで立てる：元のハンドラが立てなくても
+   VBlankIntrWait（frame_wait_vblank / frame_end の待ち）が起きられるように。
+   そのあと元のハンドラへ飛ぶ（IF の確認応答は向こうがする）。無ければ自分で確認応答とフラグを立てる */
+#ifndef HOST_BUILD
+#  ifdef NO_IWRAM
+#    define FRAME_IRQ_SECTION ".text.frame_irq"
+#  else
+#    define FRAME_IRQ_SECTION ".iwram.text.frame_irq"
+#  endif
+__asm__(
+  "  .section " FRAME_IRQ_SECTION ",\"ax\",%progbits\n"
+  "  .arm\n"
+  "  .align 2\n"
+  "  .type frame_irq_, %function\n"
+  "frame_irq_:\n"
+  "  add   r3, r0, #0x200\n"
+  "  ldrh  r1, [r3, #2]\n"              /* IF */
+  "  tst   r1, #1\n"                    /* VBlank か */
+  "  beq   1f\n"
+  "  stmfd sp!, {r0, lr}\n"
+  "  msr   cpsr_c, #0x9F\n"             /* システムモード（I=1） */
+  "  stmfd sp!, {r2, lr}\n"             /* r2 は 8 バイト境界合わせ */
+  "  ldr   r1, =frame_on_vblank\n"
+  "  mov   lr, pc\n"
+  "  bx    r1\n"
+  "  ldmfd sp!, {r2, lr}\n"
+  "  msr   cpsr_c, #0x92\n"             /* IRQ モードへ戻る */
+  "  ldmfd sp!, {r0, lr}\n"
+  "  ldrh  r2, [r0, #-8]\n"             /* 0x03FFFFF8 = 0x03007FF8 のミラー */
+  "  orr   r2, r2, #1\n"                /* IntrWait の VBlank フラグ */
+  "  strh  r2, [r0, #-8]\n"
+  "1:\n"
+  "  ldr   r1, =frame_irq_prev\n"
+  "  ldr   r1, [r1]\n"
+  "  cmp   r1, #0\n"
+  "  bxne  r1\n"
+  "  add   r3, r0, #0x200\n"
+  "  ldrh  r1, [r3, #2]\n"
+  "  strh  r1, [r3, #2]\n"              /* 確認応答 */
+  "  ldrh  r2, [r0, #-8]\n"             /* 0x03FFFFF8 = 0x03007FF8 のミラー */
+  "  orr   r2, r2, r1\n"
+  "  strh  r2, [r0, #-8]\n"
+  "  bx    lr\n"
+  "  .ltorg\n"
+  "  .size frame_irq_, . - frame_irq_\n"
+  "  .thumb\n"
+  "  .text\n"
+);
+extern void frame_irq_(void);
+
+static u16 s_prev_ie, s_prev_dispstat;   /* frame_shutdown で戻す */
+#endif
+
+/* VBlank の先頭で呼ばれる（割り込み禁止中）。確定したフレームだけ反映する */
+__attribute__((used, externally_visible))
+void frame_on_vblank(void){
+  s_vblanks++;
+  if (!s_commit) return;
+  u32 t0 = prof_now();
+  hw_state_commit();   /* DISPCNT/BLDCNT/BLDY などを先に（数本なので走査線が始まる前に済む） */
+  dmaq_flush();
+  prof_add(PROF_FLUSH, t0);
+  s_commit = 0;
+}
+
+/* =============== 公開 API =============== */
+
+void frame_init(void){
+  s_commit  = 0;
+  s_started = 0;
+  s_stats.vblanks = s_stats.frames = s_stats.dropped = s_stats.late = 0;
+  s_stats.busy_last = s_stats.busy_peak = 0;
+#ifndef HOST_BUILD
+  REG_IME = 0;
+  frame_irq_prev  = IRQ_VECTOR;
+  s_prev_ie       = REG_IE;
+  s_prev_dispstat = REG_DISPSTAT;
+  IRQ_VECTOR = frame_irq_;
+  REG_DISPSTAT |= DSTAT_VBL_IRQ;
+  REG_IE |= IRQ_VBLANK;
+  REG_IME = 1;
+#endif
+}
+
+void frame_shutdown(void){
+#ifndef HOST_BUILD
+  REG_IME = 0;
+  IRQ_VECTOR   = frame_irq_prev;
+  REG_IE       = s_prev_ie;
+  REG_DISPSTAT = (REG_DISPSTAT & ~DSTAT_VBL_IRQ) | (s_prev_dispstat & DSTAT_VBL_IRQ);
+  REG_IME = 1;
+#endif
+}
+
+int frame_begin(void){
+  u32 now = s_vblanks;
+  u32 n = now - s_seen;
+  s_seen = now;
+  s_begin = prof_now();
+  if (!s_started){ s_started = 1; return 1; }
+  if (n <= 1) return 1;
+  /* 間に転送なしの VBlank があった：その分だけロジックを進める */
+  s_stats.dropped += n - 1;
+  s_stats.late++;
+  return (n > FRAME_MAX_STEPS) ? FRAME_MAX_STEPS : (int)n;
+}
+
+void frame_end(void){
+  u32 busy = prof_now() - s_begin;
+  s_stats.busy_last = busy;
+  if (busy > s_stats.busy_peak) s_stats.busy_peak = busy;
+  s_stats.frames++;
+  s_commit = 1;
+#ifdef HOST_BUILD
+  frame_on_vblank();
+#else
+  /* 待ちはこれまでどおり ERAPI の 1 フレーム（ファームウェアの毎フレーム処理もここで回る）。
+     割り込みの入口はファームウェアのハンドラより先に走るので、戻った時には反映が済んでいる。
+     済んでいなければ次の VBlank まで CPU を止めて待つ（回して待たない。次の描画を混ぜない） */
+  ERAPI_RenderFrame(1);
+  while (s_commit) spr_wait_vblank();
+#endif
+}
+
+void frame_wait_vblank(void){
+#ifndef HOST_BUILD
+  spr_wait_vblank();
+#endif
+}
+
+void frame_get_stats(FrameStats* out){
+  if (!out) return;
+  *out = s_stats;
+  out->vblanks = s_vblanks;
+}
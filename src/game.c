@@ -2,10 +2,12 @@
 #include "rng.h"
 #include "cards.h"
 #include "render.h"
+#include "anim.h"
 #include "sound.h"
 #include "def.h"
 #include "ai.h"
 #include "deck.h"
+#include "prof.h"
 
 /* ==== サウンドID（数値直指定） ==== */
 #define SE_NORMAL_PLAY   65  /* 通常 */
@@ -68,7 +70,7 @@ static void reset_field(GameState* g){
     g->field_visible     = 0;
     g->field_count       = 0;
     g->field_eff_rank    = 0;
-    for (int i=0;i<4;++i) g->field_names[i] = NULL;
+    for (int i=0;i<4;++i){ g->field_names[i] = NULL; g->field_cards[i] = 0; }
     g->field_suit_mask   = 0;
     g->sibari_active     = 0;
     g->field_is_straight = 0;
@@ -170,6 +172,15 @@ static int is_play_legal(const GameState* g, const u8* cards, u8 n){
     return (eff > g->field_eff_rank);
 }
 
+/* 1枚単位の目安：そのカードが今の場に乗りうるか（表示の強調/減光用。枚数・階段は見ない） */
+int game_card_can_follow(const GameState* g, u8 card){
+    if (!g->field_visible) return 1;
+    if (!g->field_is_straight && g->sibari_active &&
+        !(g->field_suit_mask & (1u << CARD_SUIT(card))) && !CARD_IS_JOKER(card)) return 0;
+    u8 eff = rank_effective_ext(CARD_RANK(card), (u8)g->revolution_active, (u8)g->jback_active);
+    return (eff > g->field_eff_rank);
+}
+
 /* ====== 出し適用（革命→8切り→Jバック→場更新→階段→しばり） ======
    ・役発生：SE“要求”を立てて 1 秒待機
    ・通常出し：SE=65“要求”、待機なし
@@ -204,11 +215,11 @@ static void apply_play(GameState* g, const u8* cards, u8 n){
         }
         g->field_eff_rank = rank_effective_ext(base, (u8)g->revolution_active, (u8)g->jback_active);
 
-        for (int i=0;i<4;++i) g->field_names[i] = NULL;
-        for (u8 i=0;i<n;++i)  g->field_names[i] = card_to_string(cards[i]);
+        for (int i=0;i<4;++i){ g->field_names[i] = NULL; g->field_cards[i] = 0; }
+        for (u8 i=0;i<n;++i){ g->field_names[i] = card_to_string(cards[i]); g->field_cards[i] = cards[i]; }
         g->field_suit_mask = compute_suit_mask(cards, n);
 
-        render_set_field_cards((const char* const*)g->field_names, n);
+        render_set_field_cards(g->field_cards, n);
 
         /* ★スプライト要求 */
         s_banner_name = "yagiri"; s_banner_pending = 1; s_banner_player = -1;
@@ -245,11 +256,11 @@ static void apply_play(GameState* g, const u8* cards, u8 n){
         }
         g->field_eff_rank = rank_effective_ext(base, (u8)g->revolution_active, (u8)g->jback_active);
     }
-    for (int i=0;i<4;++i) g->field_names[i] = NULL;
-    for (u8 i=0;i<n;++i)  g->field_names[i] = card_to_string(cards[i]);
+    for (int i=0;i<4;++i){ g->field_names[i] = NULL; g->field_cards[i] = 0; }
+    for (u8 i=0;i<n;++i){ g->field_names[i] = card_to_string(cards[i]); g->field_cards[i] = cards[i]; }
     g->field_suit_mask = info.new_mask;
 
-    render_set_field_cards((const char* const*)g->field_names, n);
+    render_set_field_cards(g->field_cards, n);
 
     /* 5) 階段（★初成立時のみ表示） */
     if (g->field_is_straight && !did_role){
@@ -283,6 +294,7 @@ void game_init(GameState* g, const Hand hands[PLAYERS], int start_player_for_dea
     g->deal_turn  = start_player_for_deal & 3;
     g->deal_delay = 0;
     g->deal_done  = 0;
+    g->deal_last  = -1;
 
     g->turn_player = 0;
     g->turn_delay  = 0;
@@ -297,7 +309,7 @@ void game_init(GameState* g, const Hand hands[PLAYERS], int start_player_for_dea
     g->sibari_active     = 0;
     g->revolution_active = 0;
     g->jback_active      = 0;
-    for (int i=0;i<4;++i) g->field_names[i]=NULL;
+    for (int i=0;i<4;++i){ g->field_names[i]=NULL; g->field_cards[i]=0; }
 
     g->fx_active       = 0;
     g->fx_display_time = 0;
@@ -316,14 +328,22 @@ int game_step_deal(GameState* g){
     if (g->deal_done) return 0;
     if (g->deal_delay > 0){ --g->deal_delay; return 0; }
 
+    /* 配り終えても、飛んでいる札が全部着地するまでは完了にしない */
+    if (deal_finished_all(g)){
+        if (anim_count(ANIM_TAG_DEAL, -1) == 0) g->deal_done = 1;
+        return 0;
+    }
+    /* 同時に飛ばす枚数で配りのテンポを決める（固定ディレイではなく演出の完了待ち） */
+    if (anim_count(ANIM_TAG_DEAL, -1) >= DEAL_IN_FLIGHT_MAX) return 0;
+
     int p = g->deal_turn;
-    if (g->visible[p] < g->target[p]){
-        g->visible[p]++;
-        g->deal_delay = DEAL_DELAY_FRAMES;
-    }else{
+    while (g->visible[p] >= g->target[p]){
         g->deal_turn = (g->deal_turn + 1) & 3;
-        if (deal_finished_all(g)) g->deal_done = 1;
+        p = g->deal_turn;
     }
+    g->visible[p]++;
+    g->deal_last  = p;
+    g->deal_delay = DEAL_STAGGER_FRAMES;
     return 1;
 }
 
@@ -368,7 +388,9 @@ int game_step_turn(GameState* g, Hand hands[PLAYERS]){
     fs.field_is_straight    = g->field_is_straight;
 
     u8 chosen[4]={0,0,0,0}; u8 n=0;
+    u32 t0 = prof_now();
     int played = ai_choose_move_group(&hands[p], &fs, chosen, &n);
+    prof_add(PROF_AI, t0);
 
     if (played && n > 0 && is_play_legal(g, chosen, n)){
         for (u8 i=0;i<n;++i) remove_card_value_once(&hands[p], chosen[i]);
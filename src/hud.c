@@ -0,0 +1,97 @@
+#include "hud.h"
+#include "hud_tiles.h"
+#include "bgmap.h"
+#include "hwstate.h"
+#include "sprite_bare.h"
+
+/* ================= 配置 ================= */
+
+#define PAL_HUD 2                       /* BG パレットバンク */
+
+/* 手番マーカーのセル（プレイヤ別） */
+static const u8 kTurnCell[PLAYERS][2] = { {0,14}, {2,1}, {11,1}, {22,1} };
+/* CPU 残り枚数（2桁）の左セル */
+static const u8 kCountCell[PLAYERS][2] = { {0,0}, {8,1}, {18,1}, {28,1} };
+/* 状態アイコン（革命 / 11バック / しばり）のセル */
+#define HUD_ICON_X 27
+#define HUD_ICON_Y 7
+
+enum { HUD_F_REV = 1, HUD_F_JBACK = 2, HUD_F_SIBARI = 4 };
+
+/* ================= 内部状態 ================= */
+
+static int s_tile0 = -1;                /* HUD タイル先頭の BG キャラ番号 */
+static s8  s_shown_count[PLAYERS];      /* 表示中の枚数（-1=未表示） */
+static s8  s_shown_turn;                /* 表示中の手番（-1=なし） */
+static u8  s_shown_flags;
+
+/* ================= 内部ヘルパ ================= */
+
+static inline u16 hud_se_(int tile){
+  return BG_SE(s_tile0 + tile, PAL_HUD);
+}
+
+static void put_count_(int p, int n){
+  int x = kCountCell[p][0], y = kCountCell[p][1];
+  if (n < 0){ bgmap_restore(x, y); bgmap_restore(x+1, y); return; }
+  if (n > 99) n = 99;
+  int tens = 0;
+  while (n >= 10){ n -= 10; tens++; }   /* 2桁なので除算は使わない */
+  if (tens) bgmap_set(x, y, hud_se_(HUD_TILE_DIGIT_0 + tens));
+  else      bgmap_restore(x, y);
+  bgmap_set(x+1, y, hud_se_(HUD_TILE_DIGIT_0 + n));
+}
+
+static void put_turn_(int p, int on){
+  if (p < 0) return;
+  if (on) bgmap_set(kTurnCell[p][0], kTurnCell[p][1], hud_se_(HUD_TILE_TURN));
+  else    bgmap_restore(kTurnCell[p][0], kTurnCell[p][1]);
+}
+
+static void put_icon_(int i, int tile, int on){
+  if (on) bgmap_set(HUD_ICON_X + i, HUD_ICON_Y, hud_se_(tile));
+  else    bgmap_restore(HUD_ICON_X + i, HUD_ICON_Y);
+}
+
+/* =============== 公開 API =============== */
+
+void hud_init(void){
+  s_tile0 = bgmap_alloc_tiles_lz(hud_tilesTilesLZ, HUD_TILE_COUNT, "hud_tiles");
+  hw_bg_pal_load(PAL_HUD, hud_tilesPal);
+  for (int p=0;p<PLAYERS;++p) s_shown_count[p] = -1;
+  s_shown_turn  = -1;
+  s_shown_flags = 0;
+}
+
+void hud_update(const GameState* g){
+  if (s_tile0 < 0 || !g) return;
+
+  /* CPU 残り枚数 */
+  for (int p=1;p<PLAYERS;++p){
+    int n = g->visible[p];
+    if (n == s_shown_count[p]) continue;
+    put_count_(p, n);
+    s_shown_count[p] = (s8)n;
+  }
+
+  /* 手番（配り終わるまでは出さない） */
+  int turn = g->deal_done ? g->turn_player : -1;
+  if (turn != s_shown_turn){
+    put_turn_(s_shown_turn, 0);
+    put_turn_(turn, 1);
+    s_shown_turn = (s8)turn;
+  }
+
+  /* 状態アイコン */
+  u8 f = 0;
+  if (g->revolution_active) f |= HUD_F_REV;
+  if (g->jback_active)      f |= HUD_F_JBACK;
+  if (g->sibari_active)     f |= HUD_F_SIBARI;
+  u8 diff = f ^ s_shown_flags;
+  if (diff){
+    if (diff & HUD_F_REV)    put_icon_(0, HUD_TILE_REV,    f & HUD_F_REV);
+    if (diff & HUD_F_JBACK)  put_icon_(1, HUD_TILE_JBACK,  f & HUD_F_JBACK);
+    if (diff & HUD_F_SIBARI) put_icon_(2, HUD_TILE_SIBARI, f & HUD_F_SIBARI);
+    s_shown_flags = f;
+  }
+}
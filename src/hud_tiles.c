@@ -0,0 +1,16 @@
+#include "hud_tiles.h"
+
+const unsigned int hud_tilesTilesLZ[59] __attribute__((aligned(4), section(".initdata"))) = {
+  0x0001C010, 0x00111001, 0x02102100, 0x100203E0, 0x00000211, 0x01030022, 0x10000007, 0x24000021,
+  0x1F5003B0, 0x003F50AA, 0x00210310, 0x0620220F, 0x00115600, 0x1FC0201F, 0xD0181010, 0x00DE105F,
+  0x100B004F, 0x37101740, 0x03104B20, 0x0F10EF00, 0x27003F00, 0x20870011, 0x203FC02B, 0x0002775F,
+  0x00461013, 0x23002123, 0x3F101F90, 0x7012203F, 0x00BB209F, 0x605E40A3, 0x7933509F, 0xE02B0021,
+  0x001F605F, 0x00212260, 0x70226D0B, 0x330100BF, 0x04000310, 0xE0040033, 0x13300330, 0x44440110,
+  0x00140444, 0x14044101, 0x14041414, 0x0300417C, 0x03000710, 0x1F101710, 0x55005555, 0x11155505,
+  0x57555505, 0x15032051, 0x00110710, 0x10170013, 0x6666001F, 0x11660666, 0x166C0661, 0x03000720,
+  0x200B0066, 0x80066607, 0x00001F10, 
+};
+
+const unsigned short hud_tilesPal[16] __attribute__((aligned(4))) = {
+  0x0000,0x7BDE,0x1463,0x1B5E,0x18FC,0x75E8,0x26C7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
@@ -0,0 +1,107 @@
+#include "hwstate.h"
+#include "sprite_bare.h"
+#include "dmaq.h"
+
+/* ================= 内部状態 ================= */
+
+/* LCD系レジスタ（0x000..0x05F）のシャドウ。valid=0 の間は必ず書く。
+   書き込みは dirty に印を付けるだけで、hw_state_commit（VBlank の先頭）でまとめて反映する */
+#define IO_SLOTS (REG_OFS_LCD_END / 2)
+static u16 s_io_shadow[IO_SLOTS];
+static u8  s_io_valid [IO_SLOTS];
+static u8  s_io_dirty [IO_SLOTS];
+static u8  s_any_dirty;
+
+/* DISPCNT は ERAPI も書き換えるので、値ではなく「落とす/立てる」ビットで持って反映時に読み書きする */
+static u16 s_disp_clear, s_disp_set;
+
+/* パレット：BG/OBJ × 16バンク × 16色 のシャドウ */
+static u16 s_pal_shadow[2][16][16];
+static u8  s_pal_valid [2][16];
+
+static HwStateStats s_stats;
+
+/* ================= 内部ヘルパ ================= */
+
+static void pal_load_(int kind, volatile u16* hw, int bank, const u16 pal[16]){
+  if (!pal || bank < 0 || bank > 15) return;
+
+  u16* sh = s_pal_shadow[kind][bank];
+  if (s_pal_valid[kind][bank]){
+    int same = 1;
+    for (int i=0;i<16;++i){ if (sh[i] != pal[i]){ same = 0; break; } }
+    if (same){ s_stats.pal_skips++; return; }
+  }
+
+  for (int i=0;i<16;++i) sh[i] = pal[i];
+  s_pal_valid[kind][bank] = 1;
+  /* シャドウを転送元にして VBlank で反映（16色=32B=8ワード） */
+  dmaq_push((void*)&hw[bank*16], sh, 8, DMAQ_PRIO_HIGH);
+  s_stats.pal_writes++;
+}
+
+/* =============== 公開 API =============== */
+
+void hw_state_invalidate(void){
+  for (int i=0;i<IO_SLOTS;++i) s_io_valid[i] = 0;
+  for (int k=0;k<2;++k) for (int b=0;b<16;++b) s_pal_valid[k][b] = 0;
+}
+
+/* DISPCNT は ERAPI も書き換えるため、シャドウではなく実レジスタ（に反映待ちを重ねた値）と比較する */
+void hw_dispcnt_update(u16 clear_mask, u16 set_bits){
+  u16 cur  = REG_IO16(REG_OFS_DISPCNT);
+  if (s_io_dirty[0]) cur = (u16)((cur & ~s_disp_clear) | s_disp_set);
+  u16 want = (u16)((cur & ~clear_mask) | set_bits);
+  if (want == cur){ s_stats.reg_skips++; return; }
+  s_disp_clear |= clear_mask;
+  s_disp_set    = (u16)((s_disp_set & ~clear_mask) | set_bits);
+  s_io_shadow[0] = want; s_io_valid[0] = 1;
+  s_io_dirty[0] = 1; s_any_dirty = 1;
+}
+
+void hw_reg16_set(u32 ofs, u16 val){
+  if (ofs == REG_OFS_DISPCNT){ hw_dispcnt_update(0xFFFF, val); return; }
+  if (ofs >= REG_OFS_LCD_END || (ofs & 1)){
+    /* 範囲外はキャッシュせずそのまま書く */
+    REG_IO16(ofs) = val;
+    s_stats.reg_writes++;
+    return;
+  }
+  u32 i = ofs >> 1;
+  if (s_io_valid[i] && s_io_shadow[i] == val){ s_stats.reg_skips++; return; }
+  s_io_shadow[i] = val; s_io_valid[i] = 1;
+  s_io_dirty[i] = 1; s_any_dirty = 1;
+}
+
+void hw_state_commit(void){
+  if (!s_any_dirty) return;
+  if (s_io_dirty[0]){
+    REG_IO16(REG_OFS_DISPCNT) = (u16)((REG_IO16(REG_OFS_DISPCNT) & ~s_disp_clear) | s_disp_set);
+    s_disp_clear = s_disp_set = 0;
+    s_io_dirty[0] = 0;
+    s_stats.reg_writes++;
+  }
+  for (u32 i=1;i<IO_SLOTS;++i){
+    if (!s_io_dirty[i]) continue;
+    REG_IO16(i << 1) = s_io_shadow[i];
+    s_io_dirty[i] = 0;
+    s_stats.reg_writes++;
+  }
+  s_any_dirty = 0;
+}
+
+void hw_obj_pal_load(int bank, const u16 pal[16]){ pal_load_(1, OBJ_PAL16, bank, pal); }
+void hw_bg_pal_load (int bank, const u16 pal[16]){ pal_load_(0, BG_PAL16,  bank, pal); }
+
+void hw_state_get_stats(HwStateStats* out){
+  if (!out) return;
+  out->reg_writes = s_stats.reg_writes;
+  out->reg_skips  = s_stats.reg_skips;
+  out->pal_writes = s_stats.pal_writes;
+  out->pal_skips  = s_stats.pal_skips;
+}
+
+void hw_state_clear_stats(void){
+  s_stats.reg_writes = s_stats.reg_skips = 0;
+  s_stats.pal_writes = s_stats.pal_skips = 0;
+}
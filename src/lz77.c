@@ -0,0 +1,127 @@
+#include "lz77.h"
+#include "sprite_bare.h"
+#include "prof.h"
+
+/* ================= 内部状態 ================= */
+
+static Lz77Stats  s_stats;
+static Lz77Record s_records[LZ77_MAX_RECORDS];
+static int        s_record_count;
+
+/* ================= 内部ヘルパ ================= */
+
+#ifdef HOST_BUILD
+/* ホストには BIOS が無いので同じ形式を C で展開する（VRAM 版も同じ） */
+static void unpack_(const void* src, void* dst, int vram){
+  const u8* s = (const u8*)src;
+  u8*       d = (u8*)dst;
+  u32 n = lz77_raw_size(src), o = 0;
+  s += 4;
+  while (o < n){
+    u8 flags = *s++;
+    for (int b=0; b<8 && o<n; ++b, flags <<= 1){
+      if (flags & 0x80){
+        u32 v = ((u32)s[0] << 8) | s[1];
+        u32 len = (v >> 12) + 3, disp = (v & 0xFFF) + 1;
+        s += 2;
+        for (; len && o < n; --len, ++o) d[o] = d[o - disp];
+      }else{
+        d[o++] = *s++;
+      }
+    }
+  }
+  hostmem_count(dst, vram ? n : 0);
+}
+#else
+static void unpack_(const void* src, void* dst, int vram){
+  register const void* r0 __asm__("r0") = src;
+  register void*       r1 __asm__("r1") = dst;
+  if (vram) __asm__ volatile("swi 0x12" : "+r"(r0), "+r"(r1) :: "r2", "r3", "memory");
+  else      __asm__ volatile("swi 0x11" : "+r"(r0), "+r"(r1) :: "r2", "r3", "memory");
+}
+#endif
+
+/* 圧縮ストリームの長さ（末尾まで読んで数える。4 バイト境界に切り上げ） */
+static u32 packed_size_(const void* src){
+  const u8* s = (const u8*)src;
+  u32 n = lz77_raw_size(src), o = 0, i = 4;
+  while (o < n){
+    u8 flags = s[i++];
+    for (int b=0; b<8 && o<n; ++b, flags <<= 1){
+      if (flags & 0x80){ o += (((u32)s[i] << 8 | s[i+1]) >> 12) + 3; i += 2; }
+      else             { o++; i++; }
+    }
+  }
+  return (i + 3) & ~3u;
+}
+
+/* name の記録（無ければ空きに作る。表が埋まっていたら NULL：合計にだけ入る） */
+static Lz77Record* record_(const char* name){
+  if (!name) name = "?";
+  for (int i=0;i<s_record_count;++i){
+    const char* a = s_records[i].name; const char* b = name;
+    while (*a && *a == *b){ ++a; ++b; }
+    if (*a == *b) return &s_records[i];
+  }
+  if (s_record_count >= LZ77_MAX_RECORDS) return 0;
+  Lz77Record* r = &s_records[s_record_count++];
+  r->name = name;
+  r->calls = r->packed_bytes = r->raw_bytes = r->cycles = 0;
+  return r;
+}
+
+/* 1 回分のサイクル数を prof のカウンタで測り、合計と name の記録に積む */
+static void timed_unpack_(const void* src, void* dst, int vram, const char* name){
+  u32 t0 = prof_now();
+  unpack_(src, dst, vram);
+  u32 cyc = prof_now() - t0;
+  prof_add(PROF_LZ77, t0);
+
+  u32 raw = lz77_raw_size(src), packed = packed_size_(src);
+  s_stats.calls++;
+  s_stats.packed_bytes += packed;
+  s_stats.raw_bytes    += raw;
+  s_stats.cycles       += cyc;
+
+  Lz77Record* r = record_(name);
+  if (r){
+    r->calls++;
+    r->packed_bytes += packed;
+    r->raw_bytes    += raw;
+    r->cycles       += cyc;
+  }
+}
+
+/* =============== 公開 API =============== */
+
+u32 lz77_raw_size(const void* src){
+  return (*(const u32*)src) >> 8;
+}
+
+void lz77_unpack_wram(const void* src, void* dst, const char* name){
+  if (!src || !dst) return;
+  timed_unpack_(src, dst, 0, name);
+}
+
+void lz77_unpack_vram(const void* src, void* dst, const char* name){
+  if (!src || !dst) return;
+  timed_unpack_(src, dst, 1, name);
+}
+
+void lz77_fill_vram(void* dst, const void* src, const void* aux, u32 words){
+  (void)words;
+  lz77_unpack_vram(src, dst, (const char*)aux);
+}
+
+void lz77_get_stats(Lz77Stats* out){
+  if (!out) return;
+  out->calls        = s_stats.calls;
+  out->packed_bytes = s_stats.packed_bytes;
+  out->raw_bytes    = s_stats.raw_bytes;
+  out->cycles       = s_stats.cycles;
+}
+
+int lz77_get_records(const Lz77Record** out){
+  if (out) *out = s_records;
+  return s_record_count;
+}
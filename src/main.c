@@ -9,6 +9,15 @@
 #include "game.h"
 #include "render.h"
 #include "sound.h"
+#include "dmaq.h"
+#include "hwstate.h"
+#include "blend.h"
+#include "hud.h"
+#include "scratch.h"
+#include "prof.h"
+#include "frame.h"
+#include "arena.h"
+#include "memwatch.h"
 
 /* game.c 側のエクスポート（ヘッダは触らず extern 宣言で使う） */
 extern int game_consume_pending_sfx(int* out_id);
@@ -20,15 +29,12 @@ extern int game_consume_pending_banner(const char** out_name, int* out_player);
 /* ★render 側の前方宣言（ヘッダは触らない） */
 extern void render_set_banner_player(int player);
 
-/* 画面のVBlank開始まで待つ（描画同期） */
-static inline void wait_vblank_start(void){
-  while (REG_VCOUNT >= 160);
-  while (REG_VCOUNT < 160);
-}
 extern int __end[];
 
 /* 背景/VRAMの初期化 */
 static void init_system(void){
+  prof_init();
+  frame_init();   /* VBlank 割り込み（確定したフレームのレジスタと転送を反映する） */
   int kb = ((ERAPI_RAM_END - (u32)__end) >> 10) - 32; if (kb < 0) kb = 0;
   ERAPI_InitMemory(kb);
   ERAPI_SetBackgroundMode(0);
@@ -36,9 +42,7 @@ static void init_system(void){
 
 /* ゲーム用の大域変数類 */
 static GameState g;
-static int g_player_face_tile_base[12];
 static int g_back_tile_base = 0;
-static int g_field_tile_base = -1;
 static int banner_shown = 0;
 
 int main(void){
@@ -55,8 +59,14 @@ int main(void){
   /* デッキ構築・乱数初期化・配布 */
   u8 deck[MAX_DECK];
   int deck_n = build_deck(deck);
-  rng_seed(15, 120);
+#ifdef RNG_FIXED_SEED
+  rng_set_seed(RNG_FIXED_SEED);   /* make SEED=... で同じ配りを再現 */
+#else
+  rng_seed_auto();
+#endif
+  u32 t0 = prof_now();
   shuffle_deck(deck, deck_n);
+  prof_add(PROF_SHUFFLE, t0);
   Hand hands[PLAYERS];
   deal_round_robin(deck, deck_n, 1, hands);
   for (int p=0; p<PLAYERS; ++p) sort_hand(&hands[p]);
@@ -66,83 +76,137 @@ int main(void){
   const Hand* myhand = &hands[0];
 
   /* VRAM 初期セットアップ */
-  wait_vblank_start();
-  render_init_vram(myhand, /*max_player_show=*/12,
-                   g_player_face_tile_base,
-                   &g_back_tile_base,
-                   &g_field_tile_base);
+  frame_wait_vblank();
+  render_init_vram(myhand, &g_back_tile_base);
+  hud_init();
+  /* 予算で持ち越した分も VBlank ごとに流し切る（転送元がまだ .initdata/.initbss にある） */
+  for (;;){
+    hw_state_commit();
+    dmaq_flush();
+    DmaqStats ds;
+    dmaq_get_stats(&ds);
+    if (!ds.pending) break;
+    frame_wait_vblank();
+  }
+  /* ここまでで起動時だけのデータ（BG・アトラス・HUD の元）は VRAM/RAM に移った */
+  scratch_reclaim_init();
+  /* その跡地からアリーナを取る（AI の作業配列などはこれより後にしか使わない） */
+  {
+    /* 跡地は ereader.ld が ARENA_BYTES 以上にしてある。取れなければ arena_init が止める */
+    void* heap = scratch_alloc(ARENA_BYTES);
+    arena_init(heap, ARENA_BYTES);
+    memwatch_init(heap, ARENA_BYTES);    /* MEMWATCH=1 のときだけ */
+  }
+  /* フェードインは BLDY で（1フレーム1段。以降は render_frame が進める） */
+  blend_init();
+  blend_fade_in(1);
+  blend_update();
+  hw_state_commit();   /* 起動中は割り込みが反映しないので自分で */
   ERAPI_RenderFrame(1);
-  ERAPI_FadeIn(1);
 
   u32 prev = 0; // 前フレームの入力状況
   for(;;){
-    const char* fxname = NULL; /* 役スプライト名（毎フレーム初期化） */
+    /* 前のフレームから経った VBlank の数だけロジックを進める（固定ステップ） */
+    int steps = frame_begin();
+    memwatch_mark(MEMW_VBLANK);
+    arena_reset(ARENA_FRAME);
 
     /* 入力（Bで終了） */
     u32 key  = ERAPI_GetKeyStateRaw();
     u32 edge = key & ~prev; prev = key;
     if (edge & ERAPI_KEY_B) break;
 
-    /* 1) 配りアニメ */
-    int dealt_now = game_step_deal(&g);
-    if (dealt_now){
-      sound_play_se(SND_SE_DEAL);
-    }
+    for (int step=0; step<steps; ++step){
+      const char* fxname = NULL; /* 役スプライト名（毎ステップ初期化） */
 
-    /* 2) 配り完了の瞬間だけ BGM を開始 */
-    if (!bgm_started && g.deal_done){
-      sound_play_bgm(SND_BGM_GAME, /*loop=*/1);
-      bgm_started = 1;
-    }
+      /* 1) 配りアニメ */
+      int dealt_now = game_step_deal(&g);
+      if (dealt_now){
+        int p = g.deal_last;
+        render_anim_deal(p, g.visible[p] - 1, hands[p].cards[g.visible[p] - 1]);
+        sound_play_se(SND_SE_DEAL);
+      }
+      memwatch_mark(MEMW_DEAL);
 
-    /* 3) 通常ターン進行（役SEは game が要求→main が鳴らす） */
-    int who = g.turn_player;
-    int played = game_step_turn(&g, hands);
-    if (played){
-      if (g.field_visible && g.field_count > 0){
-        render_upload_field_cards(g.field_names, g.field_count);
+      /* 2) 配り完了の瞬間だけ BGM を開始 */
+      if (!bgm_started && g.deal_done){
+        sound_play_bgm(SND_BGM_GAME, /*loop=*/1);
+        bgm_started = 1;
       }
-      if (who == 0){
-        render_reload_hand_card(&hands[0], g_player_face_tile_base, /*start=*/0);
+
+      /* 3) 通常ターン進行（役SEは game が要求→main が鳴らす） */
+      /* 場カードの転送予約は game 側（apply_play）で済んでいる。
+         手札が減っても再転送は不要（objvram がカードIDで常駐管理） */
+      /* 出した札は出し手の位置から場へ飛ばす（着地までは場を描かない） */
+      int who = g.turn_player;
+      Hand before = hands[who];
+      if (game_step_turn(&g, hands)){
+        render_anim_play(who, g.field_cards, g.field_count, &before);
       }
-    }
+      if (g.turn_player != who) arena_reset(ARENA_TURN);   /* 手番が変わった：1 手分を戻す */
+      memwatch_mark(MEMW_CPU_TURN);
 
-    /* 4) ★ SE 再生：game の要求を1フレームに一度だけ消費して鳴らす */
-    int se_id = -1;
-    if (game_consume_pending_sfx(&se_id)){
-      sound_play_se(se_id);
-    }
+      /* 4) ★ SE 再生：game の要求を1フレームに一度だけ消費して鳴らす */
+      int se_id = -1;
+      if (game_consume_pending_sfx(&se_id)){
+        sound_play_se(se_id);
+      }
 
-    /* 4.5) ★ BGM 切替（革命ON/OFFや他の要求） */
-    int bgm_id = -1;
-    if (game_consume_pending_bgm(&bgm_id)) {
-      sound_play_bgm(bgm_id, /*loop=*/1);
-    }
+      /* 4.5) ★ BGM 切替（革命ON/OFFや他の要求） */
+      int bgm_id = -1;
+      if (game_consume_pending_bgm(&bgm_id)) {
+        sound_play_bgm(bgm_id, /*loop=*/1);
+      }
 
-    /* 5) ★ 役スプライト表示要求：game → main で消費して出す */
-    int pidx = -1;
-    if (game_consume_pending_banner(&fxname, &pidx)) {
-      render_set_banner_player(pidx);     /* ← 追加：誰の位置に出すか先に指定 */
-      render_show_role_sprite(fxname);    // 既存API
-      banner_shown = 1;
+      /* 5) ★ 役スプライト表示要求：game → main で消費して出す */
+      int pidx = -1;
+      if (game_consume_pending_banner(&fxname, &pidx)) {
+        render_set_banner_player(pidx);     /* ← 追加：誰の位置に出すか先に指定 */
+        render_show_role_sprite(fxname);    // 既存API
+        banner_shown = 1;
+      }
+
+      /* 6) ★ 待機が終わったら消す（待機は game 側 g.fx_display_time で管理） */
+      if (banner_shown && g.fx_display_time == 0) {
+        render_hide_role_sprite();
+        banner_shown = 0;
+      }
+      memwatch_mark(MEMW_EFFECTS);
     }
 
-    /* 6) ★ 待機が終わったら消す（待機は game 側 g.fx_display_time で管理） */
-    if (banner_shown && g.fx_display_time == 0) {
-      render_hide_role_sprite();
-      banner_shown = 0;
+    /* 手札の表示状態：場に乗らないカードは暗く、自分の番なら乗るカードを明るく */
+    for (int i=0;i<myhand->count;++i){
+      u8 c = myhand->cards[i];
+      int v = OBJ_PAL_NORMAL;
+      if (g.deal_done){
+        if (!game_card_can_follow(&g, c))  v = OBJ_PAL_DIMMED;
+        else if (g.turn_player == 0)       v = OBJ_PAL_HIGHLIGHT;
+      }
+      render_set_card_pal(c, v);
     }
 
+    /* HUD（CPU 枚数・手番・革命/11バック/しばり）：変わったセルだけ書く */
+    hud_update(&g);
+
     /* サウンド更新（必要に応じて） */
     sound_update();
 
     /* 描画更新 */
-    render_frame(g.visible, g_player_face_tile_base, g_back_tile_base,
-                 g.field_visible, g.field_count);
-    ERAPI_RenderFrame(1);
+    render_frame(myhand, g.visible, g.field_visible, g.field_count);
+    memwatch_mark(MEMW_RENDER);
+
+    /* 確定して待つ：次の VBlank の先頭で割り込みがこのフレームのレジスタと VRAM/パレット/OAM 転送を流す */
+    frame_end();
   }
 
-  /* 終了時 */
+  /* 終了時：黒へフェードしてから戻る */
+  blend_fade_out(1);
+  while (blend_fade_busy()){
+    frame_begin();
+    blend_update();
+    frame_end();
+  }
   sound_stop_bgm();
+  frame_shutdown();
   return ERAPI_EXIT_TO_MENU;
 }
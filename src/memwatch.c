@@ -0,0 +1,89 @@
+#include "memwatch.h"
+
+#ifdef MEMWATCH
+
+/* ereader.ld が定義する IWRAM の静的領域の末尾（塗る窓はこれより下へは伸ばさない） */
+extern u8 __iwram_bss_end[];
+
+/* ERAPI の作業域（0x030075FC の関数表を含む）の上端。sp がこれより上なら窓はここで止める */
+#define ERAPI_IWRAM_WORK_END 0x03007600u
+
+/* ================= 内部状態 ================= */
+
+MemWatch memwatch;
+static u32* s_heap;                /* memwatch.heap_base と同じ（ホストでは 32bit に入らない） */
+
+#define STACK_MARGIN 16u   /* 塗るのは sp のこれだけ下から（自分の呼び出しの分） */
+
+/* ================= 内部ヘルパ ================= */
+
+static void paint_(u32* p, u32* end){
+  while (p < end) *p++ = MEMW_CANARY;
+}
+
+#ifndef HOST_BUILD
+static u32 sp_(void){
+  u32 sp;
+  __asm__ volatile("mov %0, sp" : "=r"(sp));
+  return sp;
+}
+#endif
+
+/* =============== 公開 API =============== */
+
+void memwatch_init(void* heap, u32 heap_bytes){
+  memwatch.magic = MEMW_MAGIC;
+  for (int i=0;i<MEMW_PHASE_COUNT;++i) memwatch.stack_peak[i] = 0;
+  memwatch.stack_peak_all = 0;
+  memwatch.overflow = 0;
+#ifdef HOST_BUILD
+  /* ホストのスタックは塗らない（アリーナだけ） */
+  memwatch.stack_top = memwatch.stack_limit = memwatch.stack_free = 0;
+#else
+  /* 塗るのは今の sp の下 MEMWATCH_STACK_BYTES だけ（その下は ERAPI や静的データかもしれない） */
+  u32 top = sp_();
+  u32 lim = (top - MEMWATCH_STACK_BYTES) & ~3u;
+  u32 bss = ((u32)__iwram_bss_end + 3u) & ~3u;
+  if (top > ERAPI_IWRAM_WORK_END && lim < ERAPI_IWRAM_WORK_END) lim = ERAPI_IWRAM_WORK_END;
+  if (lim < bss) lim = bss;
+  memwatch.stack_top   = top;
+  memwatch.stack_limit = lim;
+  memwatch.stack_free  = top - lim;
+  paint_((u32*)lim, (u32*)((top - STACK_MARGIN) & ~3u));
+#endif
+  u32* h = (u32*)heap;
+  u32  n = heap ? heap_bytes / 4u : 0;
+  s_heap = h;
+  memwatch.heap_base    = (u32)(unsigned long)heap;
+  memwatch.heap_bytes   = n * 4u;
+  memwatch.heap_touched = 0;
+  paint_(h, h + n);
+}
+
+void memwatch_mark(int phase){
+  if ((unsigned)phase >= MEMW_PHASE_COUNT) return;
+#ifndef HOST_BUILD
+  /* 底から上へ見て、最初に塗りが消えている所が最深 */
+  u32* lim = (u32*)memwatch.stack_limit;
+  u32* end = (u32*)((sp_() - STACK_MARGIN) & ~3u);
+  u32* p = lim;
+  while (p < end && *p == MEMW_CANARY) p++;
+  if (p == lim && *lim != MEMW_CANARY) memwatch.overflow++;
+  if (p < end){
+    u32 depth = memwatch.stack_top - (u32)p;
+    if (depth > memwatch.stack_peak[phase]) memwatch.stack_peak[phase] = depth;
+    if (depth > memwatch.stack_peak_all){
+      memwatch.stack_peak_all = depth;
+      memwatch.stack_free = (u32)p - memwatch.stack_limit;
+    }
+    paint_(p, end);   /* 次の区間のために塗り直す */
+  }
+#endif
+  if (phase == MEMW_VBLANK){
+    u32 n = memwatch.heap_bytes / 4u, used = 0;
+    for (u32 i=0;i<n;++i) if (s_heap[i] != MEMW_CANARY) used++;
+    memwatch.heap_touched = used * 4u;
+  }
+}
+
+#endif /* MEMWATCH */
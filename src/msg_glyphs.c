@@ -0,0 +1,31 @@
+#include "msg_glyphs.h"
+
+/* 使用文字: ■　ＸＴＩＭＥ：たいしょうタイマーおんがくはけ／ */
+const unsigned int msg_glyphsTilesLZ[106] __attribute__((aligned(4), section(".initdata"))) = {
+  0x00030010, 0xF0000030, 0x11019001, 0xA0011111, 0xF0210300, 0x20211103, 0x22002222, 0x01000001,
+  0x07100010, 0x01010020, 0x00061002, 0x2A060007, 0x0D000010, 0x200D0001, 0x01203F10, 0x00222212,
+  0xE0000210, 0x00004003, 0x00111132, 0xE2221200, 0x1BB00800, 0x22221720, 0x115F1002, 0x21100000,
+  0x21010121, 0x20100221, 0x02002121, 0xDD000300, 0x5F500320, 0x00870021, 0x00AB100F, 0x025B0B00,
+  0x10010B40, 0x10C4209F, 0x6F300310, 0x400BA0E0, 0x002A001A, 0x01112210, 0x20021009, 0x00B70022,
+  0x25140021, 0x3F000021, 0x3F202000, 0x75010001, 0x00290021, 0x025B1003, 0x00003310, 0x20003D9E,
+  0x4E40A700, 0x0D010370, 0x7B450002, 0x309D1011, 0x00837063, 0xEB001034, 0x10016F10, 0x02000112,
+  0x12102202, 0xFE100060, 0x22011300, 0xF9200012, 0x3F804520, 0x0B110001, 0x10021B00, 0x125F6311,
+  0x01108100, 0x20A8104E, 0x3058109D, 0x00114D2F, 0xB112203A, 0x2013115F, 0x10BF3B00, 0x9F211023,
+  0xFF400341, 0x73510190, 0x00C314A0, 0x011F017F, 0x00222120, 0x6B891160, 0x01890122, 0x70002122,
+  0x00A00022, 0x1801D51F, 0x1110FA21, 0x3F1112AC, 0x38220002, 0x3F012011, 0x3F020D11, 0xE9102200,
+  0x1B112902, 0x01028500, 0x0021025F, 0x2000FF87, 0x97406030, 0x4F200610, 0x08109F20, 0x11FD5602,
+  0x00E3117B, 0x00760080, 0x01E3015B, 0x103D0100, 0x103E0020, 0x201FC07E, 0x23002023, 0xC05F50F0,
+  0x00067060, 0x0000005D, 
+};
+
+const unsigned short MSGT_CARD[3] = { 1,1,1 };
+const unsigned short MSGT_CLEAR[3] = { 1,1,0 };
+const unsigned short MSGT_MARK[3] = { 1,1,2 };
+const unsigned short MSGT_TIME_LABEL[7] = { 5,1,3,4,5,6,7 };
+const unsigned short MSGT_TARGET_LABEL[8] = { 6,1,8,9,10,11,12,7 };
+const unsigned short MSGT_TARGET_TIMER[6] = { 4,1,13,14,15,16 };
+const unsigned short MSGT_TARGET_MUSIC[6] = { 4,1,17,18,19,20 };
+const unsigned short MSGT_TARGET_BG[6] = { 4,1,21,9,22,9 };
+const unsigned short MSGT_MUSIC_LABEL[7] = { 5,1,17,18,19,20,7 };
+const unsigned short MSGT_BG_LABEL[7] = { 5,1,21,9,22,9,7 };
+const unsigned short MSGT_BG_SEP[3] = { 1,1,23 };
@@ -0,0 +1,37 @@
+#include "msgtext.h"
+#include "bgmap.h"
+#include "hwstate.h"
+#include "sprite_bare.h"
+
+/* ================= 内部状態 ================= */
+
+static int s_tile0    = -1;     /* グリフタイル先頭の BG キャラ番号 */
+static int s_pal_bank = 0;
+
+/* =============== 公開 API =============== */
+
+int msgtext_load(const void* tiles_lz, int tile_count, const u16* pal, int pal_bank){
+  if (!tiles_lz || tile_count <= 0) return 0;
+  s_tile0 = bgmap_alloc_tiles_lz(tiles_lz, tile_count, "msgtext");
+  if (s_tile0 < 0) return 0;
+  s_pal_bank = pal_bank & 15;
+  if (pal) hw_bg_pal_load(s_pal_bank, pal);
+  return 1;
+}
+
+void msgtext_draw(int x, int y, const u16* msg){
+  if (!msg || s_tile0 < 0) return;
+  int w = msg[0], h = msg[1];
+  const u16* t = &msg[2];
+  for (int ty=0; ty<h; ++ty){
+    for (int tx=0; tx<w; ++tx, ++t){
+      if (*t) bgmap_set(x + tx, y + ty, BG_SE(s_tile0 + *t, s_pal_bank));
+      else    bgmap_restore(x + tx, y + ty);
+    }
+  }
+}
+
+void msgtext_clear(int x, int y, const u16* msg){
+  if (!msg) return;
+  bgmap_restore_rect(x, y, msg[0], msg[1]);
+}
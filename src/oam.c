@@ -0,0 +1,89 @@
+#include "oam.h"
+#include "sprite_bare.h"
+#include "dmaq.h"
+
+/* ================= 内部状態 ================= */
+
+/* レイヤー別の上限（合計 <= OAM_ENTRIES） */
+static const u8 kLayerQuota[OAM_LAYER_COUNT] = {
+    4,                 /* CURSOR */
+    8,                 /* BANNER */
+    32,                /* ANIM   */
+    MAX_HAND,          /* HAND   */
+    8,                 /* FIELD  */
+};
+#define OAM_STAGE_TOTAL (4 + 8 + 32 + MAX_HAND + 8)
+typedef char oam_quota_must_fit_[(OAM_STAGE_TOTAL <= OAM_ENTRIES) ? 1 : -1];
+
+static u16 s_stage[OAM_STAGE_TOTAL][3] IWRAM_BSS;      /* レイヤー毎の組み立て領域 */
+static u16 s_layer_base[OAM_LAYER_COUNT];
+static u16 s_layer_used[OAM_LAYER_COUNT];
+static u16 s_shadow[OAM_ENTRIES * 4] __attribute__((aligned(4))) IWRAM_BSS;  /* 転送元 */
+static u16 s_prev_used = OAM_ENTRIES;        /* 初回は全エントリを隠す */
+static u16 s_affine_end = 0;                 /* 今フレーム設定した行列の末尾エントリ */
+static OamStats s_stats;
+
+/* =============== 公開 API =============== */
+
+void oam_begin_frame(void){
+  u16 base = 0;
+  for (int l=0;l<OAM_LAYER_COUNT;++l){
+    s_layer_base[l] = base;
+    s_layer_used[l] = 0;
+    base += kLayerQuota[l];
+  }
+  s_stats.dropped = 0;
+  s_affine_end    = 0;
+}
+
+u16* oam_alloc(int layer){
+  if (layer < 0 || layer >= OAM_LAYER_COUNT) return NULL;
+  if (s_layer_used[layer] >= kLayerQuota[layer]){
+    s_stats.dropped++;
+    return NULL;
+  }
+  return s_stage[s_layer_base[layer] + s_layer_used[layer]++];
+}
+
+IWRAM_CODE
+void oam_commit(void){
+  int n = 0;
+  for (int l=0;l<OAM_LAYER_COUNT;++l){
+    const u16 (*src)[3] = &s_stage[s_layer_base[l]];
+    for (int i=0;i<s_layer_used[l];++i, ++n){
+      u16* d = &s_shadow[n*4];
+      d[0] = src[i][0]; d[1] = src[i][1]; d[2] = src[i][2];   /* attr3 は触らない */
+    }
+    s_stats.layer_used[l] = s_layer_used[l];
+  }
+
+  /* 前フレームより減った分だけ画面外へ */
+  for (int i=n;i<s_prev_used;++i){
+    u16* d = &s_shadow[i*4];
+    d[0] = ATTR0_Y(160); d[1] = 0; d[2] = 0;
+  }
+
+  /* 変化しうる範囲（今回と前回の大きい方）だけ転送 */
+  int span = (n > s_prev_used) ? n : s_prev_used;
+  if (span < s_affine_end) span = s_affine_end;
+  if (span > 0) dmaq_push((void*)OAM16, s_shadow, (u32)span * 2, DMAQ_PRIO_HIGH);
+
+  s_prev_used = (u16)n;
+  s_stats.used = (u16)n;
+  if (n > s_stats.peak) s_stats.peak = (u16)n;
+}
+
+void oam_set_affine(int m, s16 pa, s16 pb, s16 pc, s16 pd){
+  if (m < 0 || m >= 32) return;
+  u16* d = &s_shadow[m * 16 + 3];              /* エントリ 4m..4m+3 の attr3 */
+  d[0] = (u16)pa; d[4] = (u16)pb; d[8] = (u16)pc; d[12] = (u16)pd;
+  if (s_affine_end < (u16)(m * 4 + 4)) s_affine_end = (u16)(m * 4 + 4);
+}
+
+void oam_get_stats(OamStats* out){
+  if (!out) return;
+  out->used    = s_stats.used;
+  out->peak    = s_stats.peak;
+  out->dropped = s_stats.dropped;
+  for (int l=0;l<OAM_LAYER_COUNT;++l) out->layer_used[l] = s_stats.layer_used[l];
+}
@@ -1,582 +1,228 @@
 #include "obj_atlas.h"
 
-const unsigned int obj_atlasTiles[4056] __attribute__((aligned(4))) = {
-  0x11111111, 0x11111111, 0x11113111, 0x11113311, 0x11113111, 0x11113111, 0x11113111, 0x11113111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133311, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311111, 0x11131111, 0x11113111, 0x11111311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11333311, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311111, 0x11133111, 0x11311111, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11131311, 0x11131311, 0x11131311, 0x11333311, 0x11131111, 0x11131111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11131111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11333311, 0x11111311, 0x11111311, 0x11133311, 0x11311111, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11111311, 0x11133311, 0x11311311, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11333311, 0x11311311, 0x11311111, 0x11311111, 0x11311111, 0x11311111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11311111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311311, 0x11133111, 0x11311311, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311311, 0x11333111, 0x11311111, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x31113111, 0x13113311, 0x13113111, 0x13113111, 0x13113111, 0x13113111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111131, 0x01111131, 0x01111131, 0x01111131, 0x01111131,
-  0x31133311, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111113, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11311111, 0x11311111, 0x11311111, 0x11311111, 0x11311111, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311311, 0x11313311, 0x11331311, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x13133111, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11311311, 0x11311311, 0x11131311, 0x11113311, 0x11131311, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11311311, 0x11111111, 0x11111111, 0x13311111, 0x33331111, 0x33331111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111111, 0x01113311, 0x01133331, 0x01133333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11113111, 0x11113311, 0x11113111, 0x11113111, 0x11113111, 0x11113111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133311, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311111, 0x11131111, 0x11113111, 0x11111311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11333311, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311111, 0x11133111, 0x11311111, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11131311, 0x11131311, 0x11131311, 0x11333311, 0x11131111, 0x11131111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11131111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11333311, 0x11111311, 0x11111311, 0x11133311, 0x11311111, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11111311, 0x11133311, 0x11311311, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11333311, 0x11311311, 0x11311111, 0x11311111, 0x11311111, 0x11311111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11311111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311311, 0x11133111, 0x11311311, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311311, 0x11333111, 0x11311111, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x31113111, 0x13113311, 0x13113111, 0x13113111, 0x13113111, 0x13113111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111131, 0x01111131, 0x01111131, 0x01111131, 0x01111131,
-  0x31133311, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111113, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11311111, 0x11311111, 0x11311111, 0x11311111, 0x11311111, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11133111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11133111, 0x11311311, 0x11311311, 0x11313311, 0x11331311, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x13133111, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11311311, 0x11311311, 0x11131311, 0x11113311, 0x11131311, 0x11311311,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11311311, 0x11111111, 0x11111111, 0x31111111, 0x33111111, 0x33311111, 0x33331111, 0x33331111,
-  0x01111111, 0x01111111, 0x01111113, 0x01111133, 0x01111333, 0x01113333, 0x01133333, 0x01133333,
-  0x33311111, 0x33111111, 0x31111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01113333, 0x01111333, 0x01111133, 0x01111113, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11112111, 0x11112211, 0x11112111, 0x11112111, 0x11112111, 0x11112111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122211, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211111, 0x11121111, 0x11112111, 0x11111211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11222211, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211111, 0x11122111, 0x11211111, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11121211, 0x11121211, 0x11121211, 0x11222211, 0x11121111, 0x11121111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11121111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11222211, 0x11111211, 0x11111211, 0x11122211, 0x11211111, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11111211, 0x11122211, 0x11211211, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11222211, 0x11211211, 0x11211111, 0x11211111, 0x11211111, 0x11211111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11211111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211211, 0x11122111, 0x11211211, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211211, 0x11222111, 0x11211111, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x21112111, 0x12112211, 0x12112111, 0x12112111, 0x12112111, 0x12112111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111121, 0x01111121, 0x01111121, 0x01111121, 0x01111121,
-  0x21122211, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111112, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11211111, 0x11211111, 0x11211111, 0x11211111, 0x11211111, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211211, 0x11212211, 0x11221211, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x12122111, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11211211, 0x11211211, 0x11121211, 0x11112211, 0x11121211, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11211211, 0x11111111, 0x11111111, 0x21111111, 0x22111111, 0x22211111, 0x22221111, 0x22221111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111222, 0x01112222, 0x01122222, 0x01122222,
-  0x12211111, 0x11111111, 0x21111111, 0x22111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01112212, 0x01111112, 0x01111122, 0x01111221, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11112111, 0x11112211, 0x11112111, 0x11112111, 0x11112111, 0x11112111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122211, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211111, 0x11121111, 0x11112111, 0x11111211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11222211, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211111, 0x11122111, 0x11211111, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11121211, 0x11121211, 0x11121211, 0x11222211, 0x11121111, 0x11121111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11121111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11222211, 0x11111211, 0x11111211, 0x11122211, 0x11211111, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11111211, 0x11122211, 0x11211211, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11222211, 0x11211211, 0x11211111, 0x11211111, 0x11211111, 0x11211111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11211111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211211, 0x11122111, 0x11211211, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211211, 0x11222111, 0x11211111, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x21112111, 0x12112211, 0x12112111, 0x12112111, 0x12112111, 0x12112111,
-  0x01111111, 0x01111111, 0x01111112, 0x01111121, 0x01111121, 0x01111121, 0x01111121, 0x01111121,
-  0x21122211, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111112, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11211111, 0x11211111, 0x11211111, 0x11211111, 0x11211111, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11122111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11122111, 0x11211211, 0x11211211, 0x11212211, 0x11221211, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x12122111, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11211211, 0x11211211, 0x11121211, 0x11112211, 0x11121211, 0x11211211,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01111111,
-  0x11211211, 0x11111111, 0x22111111, 0x22211111, 0x22211111, 0x22122111, 0x21222211, 0x22222211,
-  0x01111111, 0x01111111, 0x01111112, 0x01111122, 0x01111122, 0x01112212, 0x01122221, 0x01122222,
-  0x21222211, 0x21122111, 0x22111111, 0x12211111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01122221, 0x01112211, 0x01111112, 0x01111122, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x11111111, 0x11111111, 0x11BBBB11, 0x111B1111, 0x111B1111, 0x111B1111, 0x811BBB11, 0x81111111,
-  0x01111111, 0x01111111, 0x01111111, 0x01111111, 0x01199111, 0x01199111, 0x01144888, 0x01144888,
-  0x88881111, 0x88888811, 0xAA888881, 0x1AAA8881, 0x111AA881, 0x1111A881, 0x1111A811, 0x11111111,
-  0x01199AA8, 0x011991AA, 0x0119911A, 0x01199111, 0x01199111, 0x01199111, 0x01199111, 0x01199111,
-  0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x00000000, 0x00000000,
-  0x01199111, 0x01199111, 0x01199111, 0x01111111, 0x01111111, 0x01111111, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x66666666, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-  0x06666666, 0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06000000,
-  0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-  0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06000000,
-  0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x66666666, 0x00000000, 0x00000000,
-  0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x06666666, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000006, 0x00000066, 0x00000666, 0x00006666, 0x00000666, 0x00000066, 0x00000006, 0x00000000,
-  0x11111111, 0x17373731, 0x13737371, 0x17373731, 0x13737371, 0x17373731, 0x13737371, 0x17373731,
-  0x13737371, 0x17373731, 0x13737371, 0x17373731, 0x11111111, 0x00000000, 0x00000000, 0x00000000,
-  0x22222222, 0x11111112, 0x11111112, 0x22221112, 0x11112112, 0x11112112, 0x11112112, 0x22221112,
-  0x22222222, 0x11111111, 0x11111111, 0x21111111, 0x21111112, 0x21111112, 0x22111112, 0x21111111,
-  0x22222222, 0x11111111, 0x11111111, 0x11111111, 0x22222111, 0x11211121, 0x11211112, 0x11211111,
-  0x22222222, 0x11111111, 0x11111111, 0x11111111, 0x11111112, 0x11111112, 0x11111112, 0x11111112,
-  0x22222222, 0x11111111, 0x11111111, 0x11111111, 0x11222112, 0x12111212, 0x12111122, 0x12111112,
-  0x00000022, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021,
-  0x11112112, 0x11112112, 0x11112112, 0x22221112, 0x11111112, 0x11111112, 0x22222222, 0x00000000,
-  0x21111112, 0x21111112, 0x21111112, 0x11111111, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x11121111, 0x11121121, 0x11112122, 0x22112111, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x11111112, 0x11111112, 0x11111112, 0x11111112, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x12111112, 0x12111111, 0x11211111, 0x11122211, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000022, 0x00000000,
-  0x22222222, 0x11111112, 0x11111112, 0x11112112, 0x11112112, 0x11112112, 0x11112112, 0x11112112,
-  0x22222222, 0x11111111, 0x11111111, 0x21111111, 0x21111111, 0x21111111, 0x21111111, 0x21111111,
-  0x22222222, 0x11111111, 0x11111111, 0x12111111, 0x12111111, 0x22222211, 0x12111111, 0x12111111,
-  0x22222222, 0x11111111, 0x11111111, 0x11111121, 0x11111111, 0x11111212, 0x11111111, 0x11111111,
-  0x22222222, 0x11111111, 0x11111111, 0x11111111, 0x11222112, 0x12111212, 0x12111122, 0x12111112,
-  0x00000022, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021,
-  0x11112112, 0x11112112, 0x11112112, 0x22221112, 0x11111112, 0x11111112, 0x22222222, 0x00000000,
-  0x21111111, 0x21111211, 0x21111121, 0x21111112, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x12111111, 0x12222211, 0x22111121, 0x11222211, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x11111111, 0x11111111, 0x11111111, 0x11111112, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x12111112, 0x12111111, 0x11211111, 0x11122211, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000022, 0x00000000,
-  0x22222222, 0x11111112, 0x11111112, 0x11121112, 0x11122112, 0x11121112, 0x11121112, 0x11121112,
-  0x22222222, 0x11111111, 0x11111111, 0x11111211, 0x11111221, 0x11111211, 0x11111211, 0x11111211,
-  0x22222222, 0x11111111, 0x11111111, 0x11211111, 0x12111111, 0x11121112, 0x11121112, 0x11121112,
-  0x22222222, 0x11111111, 0x11111111, 0x11111112, 0x11111121, 0x11111111, 0x11111111, 0x11111111,
-  0x22222222, 0x11111111, 0x11111111, 0x11111111, 0x11111211, 0x12222211, 0x12111211, 0x12111121,
-  0x00000022, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021,
-  0x11121112, 0x11121112, 0x11121112, 0x11222112, 0x11111112, 0x11111112, 0x22222222, 0x00000000,
-  0x11111211, 0x11111211, 0x21111211, 0x21112221, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x11121112, 0x11211112, 0x11211111, 0x11211111, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x12112121, 0x12112121, 0x11211111, 0x11122111, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x12111111, 0x12111111, 0x11221111, 0x11112211, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000022, 0x00000000,
-  0x22222222, 0x11111112, 0x11111112, 0x21222112, 0x21212112, 0x21212112, 0x21122112, 0x22212112,
-  0x22222222, 0x11111111, 0x11111111, 0x11212111, 0x11122122, 0x11212111, 0x11222122, 0x11122222,
-  0x22222222, 0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x11111111,
-  0x22222222, 0x11111111, 0x11111111, 0x22111111, 0x11211111, 0x21211111, 0x22211111, 0x11211111,
-  0x22222222, 0x11111111, 0x11111111, 0x11222211, 0x11211211, 0x11211211, 0x12211121, 0x11222211,
-  0x00000022, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021,
-  0x21212112, 0x21122112, 0x21112112, 0x21112112, 0x11111112, 0x11111112, 0x22222222, 0x00000000,
-  0x11121111, 0x11122222, 0x11121111, 0x11122222, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x21211111, 0x22211111, 0x11221111, 0x11211111, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x11211111, 0x11211211, 0x11122111, 0x12211221, 0x11111111, 0x11111111, 0x22222222, 0x00000000,
-  0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000022, 0x00000000,
-  0x55555555, 0x44444445, 0x44444445, 0x45444445, 0x55555445, 0x45444445, 0x45444445, 0x55544445,
-  0x55555555, 0x44444444, 0x44444444, 0x44444544, 0x44555555, 0x44444544, 0x44444544, 0x44445555,
-  0x55555555, 0x44444444, 0x44444444, 0x44444444, 0x44444444, 0x44444444, 0x44444444, 0x44444444,
-  0x55555555, 0x44444444, 0x44444444, 0x44444444, 0x55444444, 0x54554444, 0x54444444, 0x44444444,
-  0x55555555, 0x44444444, 0x44444444, 0x44444555, 0x44455444, 0x45545444, 0x44445555, 0x44444444,
-  0x00000055, 0x00000054, 0x00000054, 0x00000054, 0x00000054, 0x00000054, 0x00000054, 0x00000054,
-  0x44544445, 0x44544445, 0x55555445, 0x44444445, 0x44444445, 0x44444445, 0x55555555, 0x00000000,
-  0x44445445, 0x44445445, 0x44555555, 0x44444445, 0x44444445, 0x44444444, 0x55555555, 0x00000000,
-  0x44444444, 0x44444444, 0x44444444, 0x44444444, 0x44444444, 0x44444444, 0x55555555, 0x00000000,
-  0x55544444, 0x44544444, 0x55544444, 0x44444444, 0x44444444, 0x44444444, 0x55555555, 0x00000000,
-  0x44555545, 0x44544545, 0x44544545, 0x44444544, 0x44444544, 0x44444444, 0x55555555, 0x00000000,
-  0x00000054, 0x00000054, 0x00000054, 0x00000054, 0x00000054, 0x00000054, 0x00000055, 0x00000000,
-  0x22202222, 0x00202002, 0x00202002, 0x22202222, 0x00200002, 0x00200002, 0x00200002, 0x00000000,
-  0x20222202, 0x20000202, 0x20000202, 0x20222202, 0x00200002, 0x00200002, 0x20222202, 0x00000000,
-  0x00000222, 0x00000000, 0x00000000, 0x00000222, 0x00000200, 0x00000200, 0x00000222, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+const unsigned int obj_atlasTilesLZ[303] __attribute__((aligned(4), section(".initdata"))) = {
+  0x00122010, 0x4011112B, 0x03003101, 0x90074033, 0x11111903, 0x8003F001, 0x60133303, 0x3000DC42,
+  0x00330C00, 0x90039045, 0x0701112B, 0x01133331, 0x00038033, 0xCD231033, 0x01607950, 0x01300000,
+  0x00014100, 0x00015F62, 0x5C000120, 0x1F504B60, 0x01B001F0, 0x139AA0BF, 0x0B00D450, 0xA2300640,
+  0xBF80BFF0, 0x103FF0FE, 0x1007100B, 0xF00B200F, 0x133FE03F, 0x403F10FF, 0x10162003, 0xF0035037,
+  0x103FE03F, 0x2E50FF0A, 0x7F407321, 0x1F509FD0, 0x1F800B20, 0xD1FF3F20, 0xF0E471DC, 0x60FFF07F,
+  0xF00B9053, 0xD7D2411F, 0x01001FD0, 0x319D0033, 0xCF4103C0, 0x00FFDB11, 0x0003E02D, 0xB064C0CB,
+  0xF213929F, 0xF65F125F, 0x03C0E092, 0x0330BFF0, 0x41071033, 0x11FF312F, 0xF17FF0B0, 0x213B40DF,
+  0xC0EF51DF, 0x7F3FF063, 0x533FB333, 0xB3401185, 0x13E7103F, 0xFF0B2303, 0xDF501313, 0x3FF0BFA2,
+  0x1FF09FB2, 0x1FF07FB2, 0xF096C3FF, 0xF09FA11F, 0xF09F511F, 0xA1BF40BF, 0x3FF0F55F, 0x1FF03FB1,
+  0x00211960, 0x07402203, 0x2203909A, 0x403F9012, 0x03002125, 0x0340EA22, 0x25009F30, 0x010C0001,
+  0xDF012E00, 0x03001500, 0x00032012, 0x5040502B, 0x7E9FA461, 0x502B0012, 0xE429003B, 0x0079709F,
+  0x50FF1225, 0x400B0094, 0xF0823006, 0xF09F809F, 0xFB92203F, 0x0F100700, 0x3FF09E60, 0x10123FA0,
+  0xFF03403F, 0x37101620, 0x3FF00350, 0x0A103FE0, 0x53212E50, 0xD07F40FF, 0x201F509F, 0x201F800B,
+  0x509CD13F, 0x7FF0FF03, 0x5380FFF0, 0x1FF00B90, 0x9FE03E30, 0x225F0100, 0xC0219D00, 0x00FF8103,
+  0x0003E02D, 0xA090FFCB, 0x37109FE0, 0x3F923FF2, 0x03C03A90, 0x30B7BFF0, 0x07102203, 0x11212F41,
+  0xF17FF0B0, 0x3B40FBDF, 0xEF51DF21, 0x3FF063C0, 0x401F8322, 0x0300AB17, 0x227C0021, 0xF3228400,
+  0xB703101F, 0x5021F312, 0x212710DF, 0x3B106420, 0x52FF4C60, 0x002710FF, 0xE33F6019, 0xF0C2701F,
+  0xFF7F107F, 0x1FF05270, 0x1FF09F20, 0xFF601FB0, 0x1F101FF0, 0xF0DF71FF, 0xE11F001F, 0x71FFD0DF,
+  0x103FF09F, 0x7F71F25F, 0x5F311FF0, 0xBBBB0130, 0x8E1B0400, 0x1BBB0370, 0x10080081, 0x916FB903,
+  0x03201944, 0x20144888, 0x20111103, 0x02008888, 0x88888188, 0x888100AA, 0xA8811AAA, 0x8138111A,
+  0x102900A8, 0x9A061003, 0xAA5E0119, 0x401A2F00, 0x9203E037, 0x007FF91D, 0xE12BC0C1, 0x666666BF,
+  0x07000666, 0x3003F0FF, 0xB01EF003, 0xB014F003, 0xF012F003, 0x73F09F3F, 0x028A6666, 0x934022E0,
+  0x2C101C60, 0x101110F8, 0x70072035, 0x31BF257B, 0x17073737, 0x13737371, 0x07F007F0, 0x10FF3B91,
+  0x23E20101, 0x00033061, 0x25A6530B, 0xFF1D102A, 0xED1200A6, 0xC4240350, 0x11201FC0, 0xBC14CA14,
+  0xD0DB12FF, 0x20D5951F, 0x656FC003, 0x263700C2, 0x7380FFBF, 0x1F504790, 0x6D102D10, 0x41259214,
+  0xD0FF1FC0, 0xE01FD06F, 0x03FE029F, 0x14DD2431, 0x7F2410A1, 0x6003F021, 0x67231003, 0x50CB8730,
+  0xFF33F05F, 0x1C200330, 0x0B917FD1, 0x7FC16A55, 0x1FC003D0, 0x67C651FF, 0x511F9040, 0x10B1A540,
+  0x46420116, 0x0C74FFB5, 0x16625F61, 0x7FF11314, 0x5FF17CC0, 0x00FF5F92, 0x90650001, 0x41BFA001,
+  0xB0B091E8, 0xFF9E20DF, 0x3FF09E11, 0x24A23240, 0x01507350, 0x5FC2DB11, 0x216B80BF, 0x3FF2F914,
+  0x0BF80110, 0x3D01DF61, 0x780310FF, 0xC0FFF0F7, 0x10963790, 0x89E9B08E, 0x3FF1D7BD, 0x06221F32,
+  0x034021C9, 0xFE210110, 0x038388FF, 0x10C52100, 0xC1AE1107, 0xD001F05F, 0x8F46FF1F, 0x0B200E22,
+  0x45276B70, 0x7F939E61, 0x30FFA150, 0xF01FF207, 0x501F9001, 0xF01C5B6B, 0xFCA3E9FF, 0x8A108810,
+  0x73791A20, 0x3FD0A610, 0x55025555, 0x44444555, 0x45034044, 0x2054452F, 0x0330450F, 0x01000C00,
+  0x30FF1A00, 0x20140001, 0x102C400E, 0xF01FA00A, 0xDD1FF001, 0x02001200, 0x10070054, 0x54460003,
+  0x30F70330, 0x205A5077, 0x459F1037, 0x03102500, 0x50FB4610, 0x1057501B, 0xD071F01F, 0x6F00541F,
+  0xA0F46E20, 0x901F5087, 0x5480209F, 0x54540400, 0x1550456F, 0xF0542410, 0x10036003, 0xFE340128,
+  0xA0900320, 0x33F05F50, 0x1C200330, 0x0620BF21, 0x20200222, 0x20031000, 0x00EB000B, 0x1003400B,
+  0x1400021F, 0x200C0002, 0x0B10F703, 0x0B001F50, 0x86023F20, 0x400B10AB, 0x17508003, 
+};
+
+unsigned int obj_atlasTiles[1160] __attribute__((aligned(4)));
+
+const unsigned char objAtlasTileIndex[507] = {
+  0, 1, 2, 3, 4, 5, 6, 6, 7, 1, 8, 3, 4, 5, 6, 6,
+  9, 1, 10, 3, 4, 5, 6, 6, 11, 1, 12, 3, 4, 5, 6, 6,
+  13, 1, 10, 3, 4, 5, 6, 6, 14, 1, 10, 3, 4, 5, 6, 6,
+  15, 1, 16, 3, 4, 5, 6, 6, 17, 1, 10, 3, 4, 5, 6, 6,
+  18, 1, 10, 3, 4, 5, 6, 6, 19, 20, 21, 22, 4, 5, 6, 6,
+  23, 1, 10, 3, 4, 5, 6, 6, 24, 1, 25, 3, 4, 5, 6, 6,
+  26, 1, 27, 3, 4, 5, 6, 6, 0, 1, 28, 29, 4, 5, 6, 6,
+  7, 1, 30, 29, 4, 5, 6, 6, 9, 1, 31, 29, 4, 5, 6, 6,
+  11, 1, 32, 29, 4, 5, 6, 6, 13, 1, 31, 29, 4, 5, 6, 6,
+  14, 1, 31, 29, 4, 5, 6, 6, 15, 1, 33, 29, 4, 5, 6, 6,
+  17, 1, 31, 29, 4, 5, 6, 6, 18, 1, 31, 29, 4, 5, 6, 6,
+  19, 20, 34, 35, 4, 5, 6, 6, 23, 1, 31, 29, 4, 5, 6, 6,
+  24, 1, 36, 29, 4, 5, 6, 6, 26, 1, 37, 29, 4, 5, 6, 6,
+  38, 1, 39, 40, 41, 42, 6, 6, 43, 1, 44, 40, 41, 42, 6, 6,
+  45, 1, 46, 40, 41, 42, 6, 6, 47, 1, 48, 40, 41, 42, 6, 6,
+  49, 1, 46, 40, 41, 42, 6, 6, 50, 1, 46, 40, 41, 42, 6, 6,
+  51, 1, 52, 40, 41, 42, 6, 6, 53, 1, 46, 40, 41, 42, 6, 6,
+  54, 1, 46, 40, 41, 42, 6, 6, 55, 56, 57, 58, 41, 42, 6, 6,
+  59, 1, 46, 40, 41, 42, 6, 6, 60, 1, 61, 40, 41, 42, 6, 6,
+  62, 1, 63, 40, 41, 42, 6, 6, 38, 1, 64, 65, 66, 67, 6, 6,
+  43, 1, 68, 65, 66, 67, 6, 6, 45, 1, 69, 65, 66, 67, 6, 6,
+  47, 1, 70, 65, 66, 67, 6, 6, 49, 1, 69, 65, 66, 67, 6, 6,
+  50, 1, 69, 65, 66, 67, 6, 6, 51, 1, 71, 65, 66, 67, 6, 6,
+  53, 1, 69, 65, 66, 67, 6, 6, 54, 1, 69, 65, 66, 67, 6, 6,
+  55, 56, 72, 73, 66, 67, 6, 6, 59, 1, 69, 65, 66, 67, 6, 6,
+  60, 1, 74, 65, 66, 67, 6, 6, 62, 1, 75, 65, 66, 67, 6, 6,
+  76, 77, 78, 79, 80, 81, 6, 6, 82, 83, 84, 85, 86, 87, 6, 6,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 95, 107, 108, 109, 99, 100, 101, 102, 110, 111, 112, 113, 114,
+  115, 116, 117, 118, 100, 119, 102, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+  100, 129, 102, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+  143, 144, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
 };
 
 const unsigned short obj_atlasPal[16] __attribute__((aligned(4))) = {
   0x0000,0x7FFF,0x0000,0x359E,0x0E7F,0x2BDF,0x6B70,0x2115,0x3DEF,0x1574,0x5EF7,0x59A0,0x0000,0x0000,0x0000,0x0000
 };
 
+const unsigned short obj_atlasPalVariants[4][16] __attribute__((aligned(4))) = {
+  { 0x0000,0x7FFF,0x0000,0x359E,0x0E7F,0x2BDF,0x6B70,0x2115,0x3DEF,0x1574,0x5EF7,0x59A0,0x0000,0x0000,0x0000,0x0000 }, /* NORMAL */
+  { 0x0000,0x4210,0x0000,0x1CCF,0x092F,0x15F0,0x35A8,0x108A,0x2108,0x0CAA,0x318C,0x2CE0,0x0000,0x0000,0x0000,0x0000 }, /* DIMMED */
+  { 0x0000,0x7FFF,0x2D6B,0x4E5E,0x36FF,0x47DF,0x6F95,0x4218,0x56B5,0x3A58,0x6B5A,0x666B,0x2D6B,0x2D6B,0x2D6B,0x2D6B }, /* HIGHLIGHT */
+  { 0x0000,0x57BF,0x096C,0x2A5E,0x12DF,0x239F,0x4B76,0x1E19,0x3296,0x1638,0x433A,0x426C,0x096C,0x096C,0x096C,0x096C }, /* SELECTED */
+};
+
 const ObjSpriteDesc objAtlasSprites[62] = {
-  { 16, 32, 8, 1, 0, 0x06, 0x04 },
-  { 16, 32, 8, 1, 64, 0x06, 0x04 },
-  { 16, 32, 8, 1, 128, 0x06, 0x04 },
-  { 16, 32, 8, 1, 192, 0x06, 0x04 },
-  { 16, 32, 8, 1, 256, 0x06, 0x04 },
-  { 16, 32, 8, 1, 320, 0x06, 0x04 },
-  { 16, 32, 8, 1, 384, 0x06, 0x04 },
-  { 16, 32, 8, 1, 448, 0x06, 0x04 },
-  { 16, 32, 8, 1, 512, 0x06, 0x04 },
-  { 16, 32, 8, 1, 576, 0x06, 0x04 },
-  { 16, 32, 8, 1, 640, 0x06, 0x04 },
-  { 16, 32, 8, 1, 704, 0x06, 0x04 },
-  { 16, 32, 8, 1, 768, 0x06, 0x04 },
-  { 16, 32, 8, 1, 832, 0x06, 0x04 },
-  { 16, 32, 8, 1, 896, 0x06, 0x04 },
-  { 16, 32, 8, 1, 960, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1024, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1088, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1152, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1216, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1280, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1344, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1408, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1472, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1536, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1600, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1664, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1728, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1792, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1856, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1920, 0x06, 0x04 },
-  { 16, 32, 8, 1, 1984, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2048, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2112, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2176, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2240, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2304, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2368, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2432, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2496, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2560, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2624, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2688, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2752, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2816, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2880, 0x06, 0x04 },
-  { 16, 32, 8, 1, 2944, 0x06, 0x04 },
-  { 16, 32, 8, 1, 3008, 0x06, 0x04 },
-  { 16, 32, 8, 1, 3072, 0x06, 0x04 },
-  { 16, 32, 8, 1, 3136, 0x06, 0x04 },
-  { 16, 32, 8, 1, 3200, 0x06, 0x04 },
-  { 16, 32, 8, 1, 3264, 0x06, 0x04 },
-  { 16, 32, 8, 1, 3328, 0x06, 0x04 },
-  { 16, 32, 8, 1, 3392, 0x06, 0x04 },
-  { 8, 8, 1, 1, 3456, 0x08, 0x08 },
-  { 8, 16, 2, 1, 3464, 0x08, 0x06 },
-  { 48, 16, 12, 1, 3480, 0x02, 0x06 },
-  { 48, 16, 12, 1, 3576, 0x02, 0x06 },
-  { 48, 16, 12, 1, 3672, 0x02, 0x06 },
-  { 48, 16, 12, 1, 3768, 0x02, 0x06 },
-  { 48, 16, 12, 1, 3864, 0x02, 0x06 },
-  { 48, 16, 12, 1, 3960, 0x02, 0x06 },
+  { 16, 32, 8, 1, 0, 0x06, 0x04, 0, 1 },
+  { 16, 32, 8, 1, 8, 0x06, 0x04, 1, 1 },
+  { 16, 32, 8, 1, 16, 0x06, 0x04, 2, 1 },
+  { 16, 32, 8, 1, 24, 0x06, 0x04, 3, 1 },
+  { 16, 32, 8, 1, 32, 0x06, 0x04, 4, 1 },
+  { 16, 32, 8, 1, 40, 0x06, 0x04, 5, 1 },
+  { 16, 32, 8, 1, 48, 0x06, 0x04, 6, 1 },
+  { 16, 32, 8, 1, 56, 0x06, 0x04, 7, 1 },
+  { 16, 32, 8, 1, 64, 0x06, 0x04, 8, 1 },
+  { 16, 32, 8, 1, 72, 0x06, 0x04, 9, 1 },
+  { 16, 32, 8, 1, 80, 0x06, 0x04, 10, 1 },
+  { 16, 32, 8, 1, 88, 0x06, 0x04, 11, 1 },
+  { 16, 32, 8, 1, 96, 0x06, 0x04, 12, 1 },
+  { 16, 32, 8, 1, 104, 0x06, 0x04, 13, 1 },
+  { 16, 32, 8, 1, 112, 0x06, 0x04, 14, 1 },
+  { 16, 32, 8, 1, 120, 0x06, 0x04, 15, 1 },
+  { 16, 32, 8, 1, 128, 0x06, 0x04, 16, 1 },
+  { 16, 32, 8, 1, 136, 0x06, 0x04, 17, 1 },
+  { 16, 32, 8, 1, 144, 0x06, 0x04, 18, 1 },
+  { 16, 32, 8, 1, 152, 0x06, 0x04, 19, 1 },
+  { 16, 32, 8, 1, 160, 0x06, 0x04, 20, 1 },
+  { 16, 32, 8, 1, 168, 0x06, 0x04, 21, 1 },
+  { 16, 32, 8, 1, 176, 0x06, 0x04, 22, 1 },
+  { 16, 32, 8, 1, 184, 0x06, 0x04, 23, 1 },
+  { 16, 32, 8, 1, 192, 0x06, 0x04, 24, 1 },
+  { 16, 32, 8, 1, 200, 0x06, 0x04, 25, 1 },
+  { 16, 32, 8, 1, 208, 0x06, 0x04, 26, 1 },
+  { 16, 32, 8, 1, 216, 0x06, 0x04, 27, 1 },
+  { 16, 32, 8, 1, 224, 0x06, 0x04, 28, 1 },
+  { 16, 32, 8, 1, 232, 0x06, 0x04, 29, 1 },
+  { 16, 32, 8, 1, 240, 0x06, 0x04, 30, 1 },
+  { 16, 32, 8, 1, 248, 0x06, 0x04, 31, 1 },
+  { 16, 32, 8, 1, 256, 0x06, 0x04, 32, 1 },
+  { 16, 32, 8, 1, 264, 0x06, 0x04, 33, 1 },
+  { 16, 32, 8, 1, 272, 0x06, 0x04, 34, 1 },
+  { 16, 32, 8, 1, 280, 0x06, 0x04, 35, 1 },
+  { 16, 32, 8, 1, 288, 0x06, 0x04, 36, 1 },
+  { 16, 32, 8, 1, 296, 0x06, 0x04, 37, 1 },
+  { 16, 32, 8, 1, 304, 0x06, 0x04, 38, 1 },
+  { 16, 32, 8, 1, 312, 0x06, 0x04, 39, 1 },
+  { 16, 32, 8, 1, 320, 0x06, 0x04, 40, 1 },
+  { 16, 32, 8, 1, 328, 0x06, 0x04, 41, 1 },
+  { 16, 32, 8, 1, 336, 0x06, 0x04, 42, 1 },
+  { 16, 32, 8, 1, 344, 0x06, 0x04, 43, 1 },
+  { 16, 32, 8, 1, 352, 0x06, 0x04, 44, 1 },
+  { 16, 32, 8, 1, 360, 0x06, 0x04, 45, 1 },
+  { 16, 32, 8, 1, 368, 0x06, 0x04, 46, 1 },
+  { 16, 32, 8, 1, 376, 0x06, 0x04, 47, 1 },
+  { 16, 32, 8, 1, 384, 0x06, 0x04, 48, 1 },
+  { 16, 32, 8, 1, 392, 0x06, 0x04, 49, 1 },
+  { 16, 32, 8, 1, 400, 0x06, 0x04, 50, 1 },
+  { 16, 32, 8, 1, 408, 0x06, 0x04, 51, 1 },
+  { 16, 32, 8, 1, 416, 0x06, 0x04, 52, 1 },
+  { 16, 32, 8, 1, 424, 0x06, 0x04, 53, 1 },
+  { 8, 8, 1, 1, 432, 0x08, 0x08, 54, 1 },
+  { 8, 16, 2, 1, 433, 0x08, 0x06, 55, 1 },
+  { 48, 16, 12, 1, 435, 0x02, 0x06, 56, 2 },
+  { 48, 16, 12, 1, 447, 0x02, 0x06, 58, 2 },
+  { 48, 16, 12, 1, 459, 0x02, 0x06, 60, 2 },
+  { 48, 16, 12, 1, 471, 0x02, 0x06, 62, 2 },
+  { 48, 16, 12, 1, 483, 0x02, 0x06, 64, 2 },
+  { 48, 16, 12, 1, 495, 0x02, 0x06, 66, 2 },
+};
+
+const ObjOamPiece objAtlasPieces[68] = {
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x8000, 0x8000, 0, 0, 0 },
+  { 0x0000, 0x0000, 0, 0, 0 },
+  { 0x8000, 0x0000, 0, 0, 0 },
+  { 0x4000, 0x8000, 0, 0, 0 },
+  { 0x0000, 0x4000, 8, 32, 0 },
+  { 0x4000, 0x8000, 0, 0, 0 },
+  { 0x0000, 0x4000, 8, 32, 0 },
+  { 0x4000, 0x8000, 0, 0, 0 },
+  { 0x0000, 0x4000, 8, 32, 0 },
+  { 0x4000, 0x8000, 0, 0, 0 },
+  { 0x0000, 0x4000, 8, 32, 0 },
+  { 0x4000, 0x8000, 0, 0, 0 },
+  { 0x0000, 0x4000, 8, 32, 0 },
+  { 0x4000, 0x8000, 0, 0, 0 },
+  { 0x0000, 0x4000, 8, 32, 0 },
 };
 
 const char* objAtlasNames[62] = {
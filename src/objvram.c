@@ -0,0 +1,139 @@
+#include "objvram.h"
+#include "obj_atlas.h"
+#include "sprite_bare.h"
+#include "cards.h"
+#include "dmaq.h"
+#include "cardface.h"
+
+/* ================= 内部状態 ================= */
+
+/* カードIDは 6bit（rank<<2 | suit）なので 64 エントリで引ける */
+#define CARD_ID_SPACE 64
+
+typedef struct {
+    u8  used;
+    u8  card;
+    u16 last_use;    /* 最後に acquire されたフレーム */
+    u16 ticket;      /* 転送待ちチケット（dmaq） */
+} FaceSlot;
+
+static FaceSlot s_slots[OBJVRAM_FACE_SLOTS];
+static s8  s_card_slot [CARD_ID_SPACE];   /* card -> slot（-1=非常駐） */
+static s16 s_card_atlas[CARD_ID_SPACE];   /* card -> アトラス番号（-2=未解決） */
+static int s_tile_base  = 0;
+static int s_slot_count = 0;
+static u16 s_frame      = 0;
+static ObjVramStats s_stats;
+
+/* ================= 内部ヘルパ ================= */
+
+/* 名前検索は線形 strcmp なので、カード毎に一度だけ解決して覚えておく */
+static int atlas_index_of_(u8 card){
+  if (s_card_atlas[card] == -2){
+    s_card_atlas[card] = (s16)objAtlasFindIndex(card_to_string(card));
+  }
+  return s_card_atlas[card];
+}
+
+static int upload_face_(FaceSlot* sl, u8 card, int tile_base){
+#ifdef CARD_FACES_PROC
+  /* 表面は字形から VBlank 中に展開（アトラスには J だけが残る） */
+  if (cardface_supported(card)){
+    sl->ticket = cardface_push((u8*)OBJ_VRAM8 + tile_base * 32, card, DMAQ_PRIO_NORMAL);
+    if (sl->ticket == 0) return 0;
+    s_stats.uploads++;
+    return 1;
+  }
+#endif
+  int idx = atlas_index_of_(card);
+  if (idx < 0) return 0;
+  const ObjSpriteDesc* d = &objAtlasSprites[idx];
+  if (!(d->w == 16 && d->h == 32)) return 0;
+
+  /* アトラスは重複除去済み：タイル番号列の順に VRAM へ並べて 1D の 16x32 を組み立てる */
+  u8* dst = (u8*)OBJ_VRAM8 + tile_base * 32;
+  sl->ticket = dmaq_push_tiles(dst, obj_atlasTiles, &objAtlasTileIndex[d->index_first],
+                               OBJVRAM_FACE_TILES, DMAQ_PRIO_NORMAL);
+  if (sl->ticket == 0) return 0;
+  s_stats.uploads++;
+  return 1;
+}
+
+/* 空きスロット、無ければ今フレーム未使用の中で最古のスロット */
+static int pick_slot_(void){
+  int best = -1;
+  u16 best_age = 0;
+  for (int i=0;i<s_slot_count;++i){
+    if (!s_slots[i].used) return i;
+    u16 age = (u16)(s_frame - s_slots[i].last_use);
+    if (age == 0) continue;                 /* 今フレームで表示中 */
+    if (best < 0 || age > best_age){ best = i; best_age = age; }
+  }
+  return best;
+}
+
+/* =============== 公開 API =============== */
+
+void objvram_init(int tile_base, int slot_count){
+  if (slot_count > OBJVRAM_FACE_SLOTS) slot_count = OBJVRAM_FACE_SLOTS;
+  if (slot_count < 0) slot_count = 0;
+  s_tile_base  = tile_base;
+  s_slot_count = slot_count;
+  s_frame      = 0;
+  for (int i=0;i<OBJVRAM_FACE_SLOTS;++i){
+    s_slots[i].used = 0; s_slots[i].card = 0; s_slots[i].last_use = 0; s_slots[i].ticket = 0;
+  }
+  for (int c=0;c<CARD_ID_SPACE;++c){ s_card_slot[c] = -1; s_card_atlas[c] = -2; }
+  s_stats.uploads = s_stats.hits = s_stats.evictions = 0;
+}
+
+void objvram_begin_frame(void){
+  s_frame++;
+}
+
+int objvram_face_acquire(u8 card){
+  if (card >= CARD_ID_SPACE) return -1;
+
+  int slot = s_card_slot[card];
+  if (slot >= 0){
+    FaceSlot* sl = &s_slots[slot];
+    sl->last_use = s_frame;
+    s_stats.hits++;
+    /* 転送が VBlank でまだ反映されていなければ今フレームは描かない */
+    if (sl->ticket){
+      if (dmaq_is_pending(sl->ticket)) return -1;
+      sl->ticket = 0;
+    }
+    return s_tile_base + slot * OBJVRAM_FACE_TILES;
+  }
+
+  slot = pick_slot_();
+  if (slot < 0) return -1;
+  if (s_slots[slot].used){
+    s_card_slot[s_slots[slot].card] = -1;
+    s_stats.evictions++;
+  }
+
+  FaceSlot* sl = &s_slots[slot];
+  int tb = s_tile_base + slot * OBJVRAM_FACE_TILES;
+  if (!upload_face_(sl, card, tb)){
+    sl->used = 0;
+    return -1;
+  }
+  sl->used          = 1;
+  sl->card          = card;
+  sl->last_use      = s_frame;
+  s_card_slot[card] = (s8)slot;
+  return -1;   /* 転送は次の VBlank。表示は反映後から */
+}
+
+int objvram_tiles_used(void){
+  return s_slot_count * OBJVRAM_FACE_TILES;
+}
+
+void objvram_get_stats(ObjVramStats* out){
+  if (!out) return;
+  out->uploads   = s_stats.uploads;
+  out->hits      = s_stats.hits;
+  out->evictions = s_stats.evictions;
+}
@@ -0,0 +1,42 @@
+#include "prof.h"
+#include "sprite_bare.h"
+
+/* ================= 内部状態 ================= */
+
+ProfStat prof_stats[PROF_COUNT];
+
+/* =============== 公開 API =============== */
+
+void prof_init(void){
+  REG_TM2CNT = 0; REG_TM3CNT = 0;
+  REG_TM2D = 0;   REG_TM3D = 0;
+  REG_TM3CNT = TM_ENABLE | TM_CASCADE;
+  REG_TM2CNT = TM_ENABLE;
+  for (int i=0;i<PROF_COUNT;++i){
+    prof_stats[i].calls = prof_stats[i].cycles = prof_stats[i].max = 0;
+  }
+}
+
+u32 prof_now(void){
+  /* 下位を読む間に上位が繰り上がったら読み直す */
+  u16 hi, lo;
+  do {
+    hi = REG_TM3D;
+    lo = REG_TM2D;
+  } while (hi != REG_TM3D);
+  return ((u32)hi << 16) | lo;
+}
+
+void prof_add(int slot, u32 t0){
+  if ((unsigned)slot >= PROF_COUNT) return;
+  u32 d = prof_now() - t0;
+  ProfStat* s = &prof_stats[slot];
+  s->calls++;
+  s->cycles += d;
+  if (d > s->max) s->max = d;
+}
+
+void prof_get(int slot, ProfStat* out){
+  if (!out || (unsigned)slot >= PROF_COUNT) return;
+  *out = prof_stats[slot];
+}
@@ -4,10 +4,24 @@
 #include "erapi.h"
 #include "cards.h"
 #include "bg.h"
+#include "hwstate.h"
+#include "objvram.h"
+#include "dmaq.h"
+#include "oam.h"
+#include "anim.h"
+#include "bgmap.h"
+#include "blend.h"
+#include "lz77.h"
+#include "prof.h"
 
 /* ================= 初期化 ================= */
 
 void render_init_ui(void) {
+  /* 圧縮アセットを RAM へ展開（BG マップは ERAPI へ渡す平らな形、アトラスはタイル集め転送の元になる） */
+  lz77_unpack_wram(bgTilesLZ, bgTiles, "bg");
+  bgmap_sparse_expand(bgMapSparse, bgMap);
+  lz77_unpack_wram(obj_atlasTilesLZ, obj_atlasTiles, "obj_atlas");
+
   ERAPI_BACKGROUND bg = {
     .data_gfx = (u8*)bgTiles,
     .data_pal = (u8*)bgPal,
@@ -17,6 +31,11 @@ void render_init_ui(void) {
   };
   ERAPI_LoadBackgroundCustom(0, &bg);
   ERAPI_LayerShow(0);
+  /* ERAPI が DISPCNT/BGパレットを書き換えたのでキャッシュを捨てる */
+  hw_state_invalidate();
+  /* BG0 のマップをシャドウに取る（CPU 裏面などは背景画像の後ろのキャラに置く）。
+     元の絵は疎マップから引くので、bgMap は ERAPI に渡した後は使わない */
+  bgmap_init_sparse(bgMapSparse, bgTilesLen / 32);
 }
 
 /* ================= 内部状態 ================= */
@@ -24,175 +43,281 @@ void render_init_ui(void) {
 /* エフェクト寿命（将来復帰用。描画はしない） */
 static int s_fx_time[FXE_COUNT] = {0};
 
-/* 場スロット（表 16x32 = 8タイル×4） */
-static int s_field_slot0_base = -1;
-static int s_field_tile_bases[4] = {-1,-1,-1,-1};
+/* 場のカード（表面タイルは objvram が常駐管理する） */
+static u8  s_field_cards[4] = {0,0,0,0};
 static int s_field_count = 0;
 
 /* 役バナー：VRAMタイル先頭 / 表示フラグ / いまVRAMに載っている名前 */
-static int  s_banner_tile_base = -1;       /* 12タイル確保（48x16 = 6x2 タイル） */
+static int  s_banner_tile_base = -1;       /* アトラス中で最大のスプライト分を確保 */
 static int  s_banner_visible   = 0;
-static char s_banner_loaded[16] = {0};     /* キャッシュ名 */
+static int  s_banner_loaded    = -1;       /* いま VRAM にあるアトラス番号 */
 /* ★追加：-1=中央/0..3=各プレイヤの位置に表示 */
 static int  s_banner_anchor_player = -1;
+/* バナー転送のチケット（VBlank で反映されるまで表示しない） */
+static u16  s_banner_ticket = 0;
+/* PASS は卓を暗くしない */
+static int  s_pass_idx = -1;
+
+/* CPU 裏面のアトラス番号 / VRAM タイル先頭 */
+static int  s_back_idx = -1;
+static int  s_back_tile_base = -1;
+
+/* CPU 裏面は BG0 のマップに並べる（BG キャラ番号 / いま並んでいる枚数） */
+#define PAL_BG_CARDS 1                     /* BG 側でアトラスパレットを置くバンク */
+static int  s_bg_back_tile = -1;
+static int  s_cpu_shown[PLAYERS] = {0,0,0,0};
+
+/* カードごとの表示状態（OBJ_PAL_*）。attr2 のパレットバンクになる */
+static u8   s_card_pal[64];
 
 /* ================= ユーティリティ ================= */
 
-static inline void force_obj_1d(void){
-  REG_DISPCNT = (REG_DISPCNT & ~DCNT_OBJ) | DCNT_OBJ | DCNT_OBJ_1D;
+/* MODE0 + OBJ(1D) と OBJ パレットを要求する（変化が無ければ書き込みは抑止される）
+   派生パレット（バンク1..）は render_init_vram で一度だけ載せる */
+static inline void apply_display_state_(void){
+  hw_dispcnt_update(0x0007 | DCNT_OBJ | DCNT_OBJ_1D, DCNT_MODE0 | DCNT_OBJ | DCNT_OBJ_1D);
+  hw_obj_pal_load(0, obj_atlasPal);
 }
 
-static void upload_face_16x32_once_(const char* name, int tile_base, int pal_bank){
-  int idx = objAtlasFindIndex(name);
-  if (idx < 0) return;
+/* スプライト1枚分のタイルを VRAM へ（タイル番号列は OBJ 1D 順。プールから集めて並べる） */
+static u16 upload_sprite_(int idx, int tile_base, int prio){
+  if (idx < 0) return 0;
   const ObjSpriteDesc* d = &objAtlasSprites[idx];
-  if (!(d->w == 16 && d->h == 32)) return;
+  u8* dst = (u8*)OBJ_VRAM8 + tile_base * 32;
+  return dmaq_push_tiles(dst, obj_atlasTiles, &objAtlasTileIndex[d->index_first],
+                         d->tiles_per_frame, prio);
+}
+
+/* アトラス中の最大タイル数（バナー領域の確保に使う） */
+static int atlas_max_tiles_(void){
+  int m = 0;
+  for (int i=0;i<OBJ_ATLAS_SPRITE_COUNT;++i){
+    if (objAtlasSprites[i].tiles_per_frame > m) m = objAtlasSprites[i].tiles_per_frame;
+  }
+  return m;
+}
 
-  const u8* src = ((const u8*)obj_atlasTiles) + d->offset_words * 4;
-  u8*       dst = (u8*)OBJ_VRAM8 + tile_base * 32;
-  /* 16x32 は 8タイル(8*32bytes) */
-  spr_dma_copy32(dst, src, (8 * 32) / 4);
-  spr_dma_copy32((void*)&OBJ_PAL16[pal_bank*16], obj_atlasPal, 8);
+/* OAM 設定ヘルパー（アロケータから確保したエントリに書く） */
+static inline void put_face_16x32_(int layer, int x, int y, int tile_base, int pal_bank){
+  u16* oo = oam_alloc(layer);
+  if (!oo) return;
+  oo[0] = ATTR0_Y(y) | ATTR0_MODE_REG | ATTR0_4BPP | ATTR0_SHAPE_TALL;
+  oo[1] = ATTR1_X(x) | ATTR1_SIZE(2);
+  oo[2] = ATTR2_TILE(tile_base) | ATTR2_PBANK(pal_bank);
 }
 
-static void upload_back_8x16_once_(const char* name, int tile_base, int pal_bank){
-  int idx = objAtlasFindIndex(name);
-  if (idx < 0) return;
+/* コンバータ生成の OAM テンプレートでスプライトを描く */
+static void put_sprite_(int layer, int idx, int x, int y, int tile_base, int pal_bank, u16 mode){
   const ObjSpriteDesc* d = &objAtlasSprites[idx];
-  if (!(d->w == 8 && d->h == 16)) return;
+  const ObjOamPiece*   pc = &objAtlasPieces[d->piece_first];
+  for (int i=0;i<d->piece_count;++i, ++pc){
+    u16* oo = oam_alloc(layer);
+    if (!oo) return;
+    oo[0] = ATTR0_Y(y + pc->dy) | mode | ATTR0_4BPP | pc->attr0;
+    oo[1] = ATTR1_X(x + pc->dx) | pc->attr1;
+    oo[2] = ATTR2_TILE(tile_base + pc->tile) | ATTR2_PBANK(pal_bank);
+  }
+}
 
-  const u8* src = ((const u8*)obj_atlasTiles) + d->offset_words * 4;
-  u8*       dst = (u8*)OBJ_VRAM8 + tile_base * 32;
-  /* 8x16 は 2タイル(2*32bytes) */
-  spr_dma_copy32(dst, src, (2 * 32) / 4);
-  spr_dma_copy32((void*)&OBJ_PAL16[pal_bank*16], obj_atlasPal, 8);
+/* 手札の横位置：並べきれない枚数は間隔を詰めて重ねる（右のカードが手前） */
+static inline int hand_card_x_(int i, int n){
+  const int face_w = 16, gap = 1;
+  const int left = 8, right = 240 - 8;
+  int step = face_w + gap;
+  if (n > 1 && left + (n-1)*step + face_w > right){
+    step = (right - left - face_w) / (n-1);
+  }
+  return left + i*step;
 }
 
-/* 48x16 バナーを 12タイル(6x2)として VRAM に転送 */
-static void upload_banner_48x16_once_(const char* name, int tile_base, int pal_bank){
-  int idx = objAtlasFindIndex(name);
-  if (idx < 0) return;
-  const ObjSpriteDesc* d = &objAtlasSprites[idx];
-  if (!(d->w == 48 && d->h == 16)) return;
-
-  const u8* src = ((const u8*)obj_atlasTiles) + d->offset_words * 4;
-  u8*       dst = (u8*)OBJ_VRAM8 + tile_base * 32;
-
-  /* タイルは 6(横) x 2(縦)。1Dで16x16を正しく組むため、
-     [0,1,6,7] を dst[0..3] に、[2,3,8,9] を dst[4..7] に、
-     [4,5,10,11] を dst[8..11] に並べ替えてコピーする */
-  const int tiles_w = 6;
-  const int tiles_h = 2; /* 高さ16なので2行 */
-  const int TILE_BYTES = 32;
-
-  /* ブロック i=0..2（左/中央/右 の 16x16） */
-  for (int i = 0; i < 3; ++i){
-    int c = i * 2;              /* このブロックの先頭列（8x8単位） */
-    int src_idx[4] = {
-      /* 上段2枚 */ c + 0, c + 1,
-      /* 下段2枚 */ c + tiles_w + 0, c + tiles_w + 1
-    };
-    int dst_off = i * 4;        /* このブロックの出力先（4タイル分） */
-    for (int j = 0; j < 4; ++j){
-      const u8* s = src + src_idx[j] * TILE_BYTES;
-      u8*       d2 = dst + (dst_off + j) * TILE_BYTES;
-      spr_dma_copy32(d2, s, TILE_BYTES / 4);
+/* CPU 裏面のセル（8x8 グリッド）：1行 CPU_ROW_MAX 枚で折り返す。1枚は 1x2 セル
+   BG のマップに置くので位置は 8px 単位。OBJ で並べていた頃（x=0/8/90/170, y=15 から
+   横 9px・縦 18px 間隔）とは違い、横は隙間なしの 8px、縦は 16px 間隔、開始は
+   x=0/8/88/168, y=16 になる。9px/18px はセルの倍数にならないので戻せない */
+#define CPU_ROW_MAX 7
+static void cpu_back_cell_(int p, int i, int* tx, int* ty){
+  static const u8 kCpuStartTX[PLAYERS] = { 0, 1, 11, 21 };
+  const int cpu_start_ty = 2;
+  int row=i/CPU_ROW_MAX, col=i%CPU_ROW_MAX;
+  *tx = kCpuStartTX[p] + col;
+  *ty = cpu_start_ty + row*2;
+}
+static void cpu_back_pos_(int p, int i, int* x, int* y){
+  cpu_back_cell_(p, i, x, y);
+  *x *= 8; *y *= 8;
+}
+
+/* CPU p の並びを show 枚にする（増減したセルだけ書き換える） */
+static void cpu_backs_update_(int p, int show){
+  if (show < 0) show = 0;
+  if (show > MAX_HAND) show = MAX_HAND;
+  int from = s_cpu_shown[p], to = show;
+  if (from == to || s_bg_back_tile < 0) return;
+  int lo = (from < to) ? from : to, hi = (from < to) ? to : from;
+  for (int i=lo;i<hi;i++){
+    int tx, ty;
+    cpu_back_cell_(p, i, &tx, &ty);
+    if (i < show){
+      bgmap_set(tx, ty,   BG_SE(s_bg_back_tile,   PAL_BG_CARDS));
+      bgmap_set(tx, ty+1, BG_SE(s_bg_back_tile+1, PAL_BG_CARDS));
+    }else{
+      bgmap_restore(tx, ty);
+      bgmap_restore(tx, ty+1);
     }
   }
-    spr_dma_copy32((void*)&OBJ_PAL16[pal_bank*16], obj_atlasPal, 8);
+  s_cpu_shown[p] = show;
 }
 
-/* OAM 設定ヘルパー */
-static inline void oam_set_face_16x32_(int oam, int x, int y, int tile_base, int pal_bank){
-  volatile u16* oo = OAM_ATTR(oam);
-  oo[0] = ATTR0_Y(y) | ATTR0_MODE_REG | ATTR0_4BPP | ATTR0_SHAPE_TALL;
-  oo[1] = ATTR1_X(x) | ATTR1_SIZE(2);
-  oo[2] = ATTR2_TILE(tile_base) | ATTR2_PBANK(pal_bank);
+/* 場の i 枚目の位置（中央寄せ） */
+static void field_pos_(int i, int count, int* x, int* y){
+  const int face_w=16, face_h=32, gap=2;
+  const int total_w = count*face_w + (count? (count-1)*gap : 0);
+  *x = (240/2) - (total_w/2) + i*(face_w + gap);
+  *y = (160/2) - (face_h/2) + 20;
 }
 
-static inline void oam_set_back_8x16_(int oam, int x, int y, int tile_base, int pal_bank){
-  volatile u16* oo = OAM_ATTR(oam);
-  oo[0] = ATTR0_Y(y) | ATTR0_MODE_REG | ATTR0_4BPP | ATTR0_SHAPE_TALL;
-  oo[1] = ATTR1_X(x) | ATTR1_SIZE(0);
-  oo[2] = ATTR2_TILE(tile_base) | ATTR2_PBANK(pal_bank);
+#define HAND_Y   (160 - 32 - 4)
+#define DECK_X   (120 - 8)      /* 山札（画面中央） */
+#define DECK_Y   (80 - 16)
+
+/* トゥイーン記述子：16x32 表面 */
+static void anim_face_desc_(AnimDesc* d, int tb){
+  d->attr0 = ATTR0_4BPP | ATTR0_SHAPE_TALL;
+  d->attr1 = ATTR1_SIZE(2);
+  d->attr2 = ATTR2_TILE(tb) | ATTR2_PBANK(0);
+  d->w = 16; d->h = 32;
 }
 
-/* 16x16（正方形）を1枚出す。バナーは 16x16×3 で合成表示する */
-static inline void oam_set_square_16x16_(int oam, int x, int y, int tile_base, int pal_bank){
-  volatile u16* oo = OAM_ATTR(oam);
-  oo[0] = ATTR0_Y(y) | ATTR0_MODE_REG | ATTR0_4BPP | ATTR0_SHAPE_SQ;
-  oo[1] = ATTR1_X(x) | ATTR1_SIZE(1); /* 16x16 */
-  oo[2] = ATTR2_TILE(tile_base) | ATTR2_PBANK(pal_bank);
+/* トゥイーン記述子：裏面（1ピースのテンプレート） */
+static int anim_back_desc_(AnimDesc* d, int back_tile_base){
+  if (s_back_idx < 0) return 0;
+  const ObjSpriteDesc* sd = &objAtlasSprites[s_back_idx];
+  const ObjOamPiece*   pc = &objAtlasPieces[sd->piece_first];
+  d->attr0 = ATTR0_4BPP | pc->attr0;
+  d->attr1 = pc->attr1;
+  d->attr2 = ATTR2_TILE(back_tile_base) | ATTR2_PBANK(0);
+  d->w = (u8)sd->w; d->h = (u8)sd->h;
+  return 1;
 }
 
 /* =============== 公開 API =============== */
 
-void render_init_vram(const Hand* me,
-                      int max_player_show,
-                      int out_face_tile_base[12],
-                      int* out_back_tile_base,
-                      int* out_field_tile_base)
+void render_init_vram(const Hand* me, int* out_back_tile_base)
 {
-  enum { PAL_FACE = 0, PAL_BACK = 0, PAL_BANNER = 0 };
   int tb = 0;
 
-  force_obj_1d();
-  spr_init_mode0_obj1d();
+  apply_display_state_();
+  for (int v=1; v<OBJ_PAL_VARIANTS; ++v) hw_obj_pal_load(v, obj_atlasPalVariants[v]);
+  for (int c=0; c<64; ++c) s_card_pal[c] = OBJ_PAL_NORMAL;
 
-  /* 自分の表（u8 → 名前変換してロード） */
-  int show = me->count; if (show > max_player_show) show = max_player_show;
-  for (int i=0; i<show; ++i){
-    const char* name = card_to_string(me->cards[i]);
-    upload_face_16x32_once_(name, tb, PAL_FACE);
-    out_face_tile_base[i] = tb;
-    tb += 8; /* 16x32 は 8タイル */
-  }
+  /* カード表面の常駐プール（手札＋場で共有。カードIDごとにスロット固定） */
+  objvram_init(tb, OBJVRAM_FACE_SLOTS);
+  tb += objvram_tiles_used();
 
-  /* 自分の手札領域は常に max 分確保して次の領域へ進める */
-  tb = 8 * max_player_show;
+  /* 配られた手札は最初に一度だけ載せておく */
+  for (int i=0; i<me->count; ++i){
+    objvram_face_acquire(me->cards[i]);
+  }
 
   /* CPU用 裏面（共通） */
-  const char* back = kBackName;
-  upload_back_8x16_once_(back, tb, PAL_BACK);
+  s_back_idx = objAtlasFindIndex(kBackName);
+  upload_sprite_(s_back_idx, tb, DMAQ_PRIO_NORMAL);
   if (out_back_tile_base) *out_back_tile_base = tb;
+  s_back_tile_base = tb;
   tb += 2; /* 8x16 は 2タイル */
 
-  /* 場スロット（最大4枚）の先頭ベースと個別ベース */
-  s_field_slot0_base = tb;
-  for (int i=0;i<4;++i){ s_field_tile_bases[i] = s_field_slot0_base + 8 * i; }
+  /* 手札として並ぶ CPU 裏面は BG 側：同じタイルを BG キャラにも1回だけ載せる */
+  if (s_back_idx >= 0){
+    const ObjSpriteDesc* bd = &objAtlasSprites[s_back_idx];
+    s_bg_back_tile = bgmap_alloc_tiles_indexed(obj_atlasTiles, &objAtlasTileIndex[bd->index_first], 2);
+  }
+  hw_bg_pal_load(PAL_BG_CARDS, obj_atlasPal);
+  for (int p=0;p<PLAYERS;++p) s_cpu_shown[p] = 0;
+
   s_field_count = 0;
-  tb += 8 * 4;
 
-  /* 役バナー用のVRAM（12タイル確保：48x16） */
+  /* 役バナー用のVRAM（どのサイズのバナーでも入るよう最大スプライト分） */
   s_banner_tile_base = tb;
-  tb += 12;
+  tb += atlas_max_tiles_();
 
   /* 初期状態：非表示 */
   s_banner_visible = 0;
-  s_banner_loaded[0] = '\0';
+  s_banner_loaded  = -1;
+  s_banner_ticket  = 0;
   s_banner_anchor_player = -1;
+  s_pass_idx = objAtlasFindIndex("pass");
+
+  anim_reset();
+}
+
+/* 配り：山札から player の index 枚目の位置へ飛ばす（自分は表、CPU は回転する裏） */
+void render_anim_deal(int player, int index, u8 card){
+  AnimDesc d;
+  int x, y;
+  if (player == 0){
+    int tb = objvram_face_acquire(card);
+    if (tb < 0) return;                 /* 未転送なら演出なしで即表示 */
+    anim_face_desc_(&d, tb);
+    x = hand_card_x_(index, index + 1); y = HAND_Y;
+    d.flags = 0;
+  }else{
+    if (!anim_back_desc_(&d, s_back_tile_base)) return;
+    cpu_back_pos_(player, index, &x, &y);
+    d.flags = ANIM_F_SPIN;
+  }
+  d.x0 = DECK_X; d.y0 = DECK_Y; d.x1 = (s16)x; d.y1 = (s16)y;
+  d.frames = DEAL_ANIM_FRAMES;
+  d.ease   = ANIM_EASE_OUT;
+  d.tag    = ANIM_TAG_DEAL;
+  d.user   = (s8)player;
+  anim_spawn(&d);
+}
+
+/* 出し：player の位置から場の各スロットへ（CPU の札は着地まで裏向き） */
+void render_anim_play(int player, const u8 cards[4], int count, const Hand* before){
+  if (!cards || count <= 0 || (player == 0 && !before)) return;
+  if (count > 4) count = 4;
+  int sx = 0, sy = HAND_Y;
+  if (player != 0) cpu_back_pos_(player, 3, &sx, &sy);
 
-  if (out_field_tile_base) *out_field_tile_base = s_field_slot0_base;
+  for (int i=0;i<count;i++){
+    AnimDesc d;
+    if (player == 0){
+      /* 出す前の手札で、その札が並んでいたスロットから飛ばす */
+      int slot = 0;
+      while (slot < before->count - 1 && before->cards[slot] != cards[i]) slot++;
+      sx = hand_card_x_(slot, before->count);
+    }
+    int tb = (player == 0) ? objvram_face_acquire(cards[i]) : -1;
+    if (tb >= 0) anim_face_desc_(&d, tb);
+    else if (!anim_back_desc_(&d, s_back_tile_base)) return;
+    int x, y;
+    field_pos_(i, count, &x, &y);
+    d.x0 = (s16)sx; d.y0 = (s16)sy; d.x1 = (s16)x; d.y1 = (s16)y;
+    d.frames = (u8)(PLAY_ANIM_FRAMES + i*2);
+    d.ease   = ANIM_EASE_IN_OUT;
+    d.tag    = ANIM_TAG_PLAY;
+    d.user   = (s8)player;
+    d.flags  = 0;
+    anim_spawn(&d);
+  }
 }
 
-/* 場カード「1枚だけ」転送（旧来の base 指定パス） */
-void render_upload_field_card(const char* name, int field_tile_base){
-  enum { PAL_FACE = 0 };
-  if (!(field_tile_base >= 0 && name)) return;
-  upload_face_16x32_once_(name, field_tile_base, PAL_FACE);
+/* カードの表示状態（OBJ_PAL_*）。変わるのは OAM のパレットバンクだけ */
+void render_set_card_pal(u8 card, int variant){
+  if (card >= 64 || variant < 0 || variant >= OBJ_PAL_VARIANTS) return;
+  s_card_pal[card] = (u8)variant;
 }
 
-/* 場のカード一括設定（名前配列→VRAM転送） */
-void render_set_field_cards(const char* const names[4], int count){
-  enum { PAL_FACE = 0 };
+/* 場のカード一括設定（未常駐のカードだけ VRAM に転送される） */
+void render_set_field_cards(const u8 cards[4], int count){
   s_field_count = 0;
-  if (!names || count <= 0) return;
+  if (!cards || count <= 0) return;
   if (count > 4) count = 4;
 
   for (int i=0;i<count;i++){
-    const char* nm = names[i];
-    if (!nm) continue;
-    upload_face_16x32_once_(nm, s_field_tile_bases[i], PAL_FACE);
+    s_field_cards[i] = cards[i];
+    objvram_face_acquire(cards[i]);
     s_field_count++;
   }
 }
@@ -211,26 +336,25 @@ void render_effect_enqueue(int effect /*FxEffect*/, int frames){
 void render_show_role_sprite(const char* name){
   if (!name || s_banner_tile_base < 0) return;
 
-  /* すでに同じ名前が載っていれば再転送しない */
-  int same = 0;
-  if (s_banner_loaded[0] != '\0'){
-    const char* a = s_banner_loaded; const char* b = name;
-    same = 1;
-    while (*a || *b){ if (*a != *b){ same = 0; break; } ++a; ++b; }
-  }
+  int idx = objAtlasFindIndex(name);
+  if (idx < 0) return;
 
-  if (!same){
-    /* 48x16 の画像を 12タイル分 VRAM に転送 */
-    upload_banner_48x16_once_(name, s_banner_tile_base, /*PAL_BANNER=*/0);
-    /* 名前をキャッシュ */
-    int i=0; for (; i<15 && name[i]; ++i) s_banner_loaded[i] = name[i];
-    s_banner_loaded[i] = '\0';
+  /* すでに同じスプライトが載っていれば再転送しない */
+  if (idx != s_banner_loaded){
+    s_banner_ticket = upload_sprite_(idx, s_banner_tile_base, DMAQ_PRIO_LOW);
+    s_banner_loaded = idx;
   }
   s_banner_visible = 1;
+  /* 半透明でフェードイン。役の演出中は卓を暗くする */
+  blend_set_obj_alpha(BLEND_LEVEL_MAX);
+  blend_set_dim(idx != s_pass_idx);
 }
 
 void render_hide_role_sprite(void){
   s_banner_visible = 0;
+  /* 消えきるまでは描き続ける（render_frame） */
+  blend_set_obj_alpha(0);
+  blend_set_dim(0);
 }
 
 /* ★追加：PASS を出したプレイヤの位置にバナーを出すための API */
@@ -240,61 +364,55 @@ void render_set_banner_player(int player){
 }
 
 /* 1フレーム描画（カード＋役バナー） */
-void render_frame(const int g_visible[PLAYERS],
-                  const int player_face_tile_base[12],
-                  int back_tile_base,
+void render_frame(const Hand* me,
+                  const int g_visible[PLAYERS],
                   int field_visible,
                   int field_count)
 {
-  spr_init_mode0_obj1d();
-  force_obj_1d();
-  spr_dma_copy32((void*)&OBJ_PAL16[0], obj_atlasPal, 8);
-
-  int oam = 0;
-
-  /* CPU裏（共通） */
-  const int back_w=8, back_h=16, back_gap=1;
-  const int row_max = 7;
-  const int cpu_start_y = 15;
-  const int row_spacing = back_h + 2;
-
-  { int start_x=8, base_y=cpu_start_y, show=g_visible[1];
-    for(int i=0;i<show;i++){ int row=i/row_max, col=i%row_max;
-      oam_set_back_8x16_(oam++, start_x+col*(back_w+back_gap), base_y+row*row_spacing, back_tile_base, 0); } }
-  { int start_x=90, base_y=cpu_start_y, show=g_visible[2];
-    for(int i=0;i<show;i++){ int row=i/row_max, col=i%row_max;
-      oam_set_back_8x16_(oam++, start_x+col*(back_w+back_gap), base_y+row*row_spacing, back_tile_base, 0); } }
-  { int start_x=170, base_y=cpu_start_y, show=g_visible[3];
-    for(int i=0;i<show;i++){ int row=i/row_max, col=i%row_max;
-      oam_set_back_8x16_(oam++, start_x+col*(back_w+back_gap), base_y+row*row_spacing, back_tile_base, 0); } }
-
-  /* 自分（表：最大12枚） */
-  { const int face_w=16, face_h=32, face_gap=1;
-    const int start_x=8, y=160-face_h-4;
-    int show=g_visible[0]; if (show>12) show=12;
-    for(int i=0;i<show;i++){
-      oam_set_face_16x32_(oam++, start_x+i*(face_w+face_gap), y, player_face_tile_base[i], 0);
+  /* 表示モードとパレットは変化時のみ書き込む（通常は抑止される） */
+  apply_display_state_();
+  objvram_begin_frame();
+
+  oam_begin_frame();
+
+  /* 移動中のカード（到着したものは次フレームから通常レイヤーで描く） */
+  anim_update();
+
+  /* CPU裏（BG）：枚数が変わったときだけマップを書き換える。飛んでいる札はまだ置かない */
+  for (int p=1; p<PLAYERS; ++p){
+    cpu_backs_update_(p, g_visible[p] - anim_count(ANIM_TAG_DEAL, p));
+  }
+
+  /* 自分（表）：MAX_HAND 枚まで。入りきらない分は重ねて詰める */
+  { const int y=HAND_Y;
+    int show=g_visible[0] - anim_count(ANIM_TAG_DEAL, 0);
+    if (show>me->count) show=me->count;
+    /* 右のカードを手前に見せたいので右から確保する */
+    for(int i=show-1;i>=0;i--){
+      int tb = objvram_face_acquire(me->cards[i]);
+      if (tb < 0) continue;
+      put_face_16x32_(OAM_LAYER_HAND, hand_card_x_(i, show), y, tb, s_card_pal[me->cards[i]]);
     } }
 
-  /* 場（表：最大4枚） */
-  if (field_visible){
-    int count = field_count; if (count>4) count=4; if (count<0) count=0;
-    const int face_w=16, face_h=32, gap=2;
-    const int fy = (160/2) - (face_h/2)+20;
-    const int total_w = count*face_w + (count? (count-1)*gap : 0);
-    const int start = (240/2) - (total_w/2);
+  /* 場（表：最大4枚）。出した札が飛んでいる間は着地を待つ */
+  if (field_visible && anim_count(ANIM_TAG_PLAY, -1) == 0){
+    int count = field_count; if (count>s_field_count) count=s_field_count; if (count<0) count=0;
     for (int i=0;i<count;i++){
-      int base = s_field_tile_bases[i];
+      int base = objvram_face_acquire(s_field_cards[i]);
       if (base<0) continue;
-      int dx = face_w + gap;
-      oam_set_face_16x32_(oam++, start + i*dx, fy, base, 0);
+      int x, y;
+      field_pos_(i, count, &x, &y);
+      put_face_16x32_(OAM_LAYER_FIELD, x, y, base, 0);
     }
   }
 
-  /* 役バナー：表示要求があれば 16x16×3 を指定位置に合成表示 */
-  if (s_banner_visible && s_banner_tile_base >= 0){
-    const int bw = 16;
-    const int total_w = 3 * bw;
+  /* 合成レジスタ（フェード・減光・バナーの濃さ）を1段進める */
+  blend_update();
+
+  /* 役バナー：表示要求があれば OAM テンプレートで指定位置に半透明で表示（フェードアウト中も） */
+  if ((s_banner_visible || blend_obj_alpha() > 0) &&
+      s_banner_loaded >= 0 && !dmaq_is_pending(s_banner_ticket)){
+    const int total_w = objAtlasSprites[s_banner_loaded].w;
 
     /* 既定：中央上（従来） */
     int x = (240 - total_w) / 2;
@@ -322,10 +440,7 @@ void render_frame(const int g_visible[PLAYERS],
         break;
     }
 
-    for (int i=0;i<3;i++){
-      int tb = s_banner_tile_base + i * 4; /* 16x16 は 4タイル */
-      oam_set_square_16x16_(oam++, x + i*bw, y, tb, 0);
-    }
+    put_sprite_(OAM_LAYER_BANNER, s_banner_loaded, x, y, s_banner_tile_base, 0, ATTR0_MODE_BLEND);
   }
 
   /* 役バナーの寿命カウンタ（将来復帰用） */
@@ -333,30 +448,9 @@ void render_frame(const int g_visible[PLAYERS],
     if (s_fx_time[i] > 0) s_fx_time[i]--;
   }
 
-  /* 余りOAMを画面外へ */
-  for (int i=oam; i<128; i++){
-    volatile u16* oo = OAM_ATTR(i);
-    oo[0] = ATTR0_Y(160); oo[1]=0; oo[2]=0;
-  }
-}
-
-/* まとめて場のカードロード（互換） */
-void render_upload_field_cards(const char** names, int count){
-  render_set_field_cards((const char* const*)names, count);
-}
-
-/* 自分の表カード再転送（交換/取得時） */
-void render_reload_hand_card(const Hand* me,
-                             int player_face_tile_base[12],
-                             int start_tile_base)
-{
-  enum { PAL_FACE = 0 };
-  int tb = start_tile_base;
-  int show = (me->count > 12) ? 12 : me->count;
-  for (int i = 0; i < show; ++i) {
-    const char* name = card_to_string(me->cards[i]);
-    upload_face_16x32_once_(name, tb, PAL_FACE);
-    player_face_tile_base[i] = tb;
-    tb += 8;
-  }
+  /* レイヤー順に詰めて VBlank 転送を予約（余りは画面外へ） */
+  u32 t0 = prof_now();
+  oam_commit();
+  prof_add(PROF_OAM, t0);
+  bgmap_commit();
 }
@@ -1,87 +1,130 @@
 #include "def.h"
 #include "rng.h"
+#include "prof.h"
+#include "sprite_bare.h"
 #include <stdint.h>
 
-/* GBAハードウェアレジスタ */
-#ifndef REG_BASE
-#define REG_BASE 0x04000000
-#endif
-#define REG_VCOUNT   (*(volatile unsigned short*)(REG_BASE + 0x0006))
-#define REG_TM0CNT_L (*(volatile unsigned short*)(REG_BASE + 0x0100))
-#define REG_DIV      (*(volatile unsigned int  *)(REG_BASE + 0x0204))
-
-/* xorshift32 本体 */
-static u32 s_rng_state = 2463534242u; /* 非0で初期化（全0は停止状態） */
-
-/* ランダムな待機時間の生成 */
-static inline void wait_vblank_start_inline(void){
-    /* VBlankの先頭を待つ：描画タイミング合わせ兼、時間経過の担保 */
-    while (REG_VCOUNT >= 160);
-    while (REG_VCOUNT < 160);
+/* xoshiro128** の 2^64 ジャンプ多項式 */
+static const u32 kJump[4] = { 0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu };
+
+/* 組み込みのストリーム（最初の rng_set_seed までは未初期化 → rng_next が 0 シードで作る） */
+static RngStream s_streams[RNG_STREAM_COUNT];
+static int s_ready = 0;
+static u32 s_seed  = 0;            /* いまのストリームを作ったシード */
+static u32 s_pool  = 0x9E3779B9u;  /* stir_ で溜めた揺らぎ */
+
+/* 32bit を全ビットに拡散（murmur3 の最終段） */
+static u32 avalanche_(u32 x){
+    x ^= x >> 16; x *= 0x85EBCA6Bu;
+    x ^= x >> 13; x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x;
 }
 
-/* min..max の範囲で「擬似ランダム」な待機フレーム数を決める */
-static int decide_wait_frames_(int min_frames, int max_frames){
-    if (min_frames < 0) min_frames = 0;
-    if (max_frames < min_frames) max_frames = min_frames;
+/* --- 揺らぎを溜める --- */
+static void stir_(u32 x){
+    u32 m = x ^ prof_now() ^ ((u32)REG_VCOUNT << 24);
+    s_pool = (s_pool ^ m) * 1664525u + 1013904223u;  /* LCGで拡散 */
+}
 
-    /* DIV は常時カウントアップ、TM0/VCOUNT と XOR → LCG で拡散 */
-    u32 div  = REG_DIV;
-    u32 t0   = (u32)REG_TM0CNT_L;
-    u32 vcnt = (u32)REG_VCOUNT;
+/* --- 起動時の揺らぎからシード生成（待たない）--- */
+u32 rng_seed_auto(void){
+    /* 起動した瞬間の走査線内の位置：次のラインに変わるまでのサイクル数（最大 1232）。
+       カードを読み終えたタイミングで決まるので、毎回ばらつく */
+    u16 v  = REG_VCOUNT;
+    u32 t0 = prof_now();
+    while (REG_VCOUNT == v);
+    u32 phase = prof_now() - t0;
+
+    stir_(phase);
+    stir_(((u32)v << 16) | REG_TM0D);
+
+    u32 seed = avalanche_(s_pool);
+    if (seed == 0) seed = 1;   /* 0 は「既定」に取っておく */
+    rng_set_seed(seed);
+    return seed;
+}
 
-    u32 span = (u32)(max_frames - min_frames + 1);
-    u32 x = div ^ (t0 << 16) ^ vcnt;
-    x = x * 1664525u + 1013904223u;
+void rng_set_seed(u32 seed){
+    s_seed = seed;
+    for (u32 i = 0; i < RNG_STREAM_COUNT; ++i) rng_stream_init(&s_streams[i], seed, i);
+    s_ready = 1;
+}
 
-    int add = (int)(x % span);
-    return min_frames + add;
+u32 rng_get_seed(void){
+    return s_seed;
 }
 
-/* --- ランダム待機からシード生成 --- */
-void rng_seed(int min_frames, int max_frames){
-    /* 1) フレーム数だけ待つ（VBlank同期） */
-    int frames = decide_wait_frames_(min_frames, max_frames);
-    for (int i = 0; i < frames; ++i){
-        wait_vblank_start_inline();
-    }
+/* --- ストリーム（xoshiro128**）--- */
+static inline u32 rotl_(u32 x, int k){ return (x << k) | (x >> (32 - k)); }
+
+static inline u32 next_(u32* s){
+    u32 r = rotl_(s[1] * 5u, 7) * 9u;
+    u32 t = s[1] << 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl_(s[3], 11);
+    return r;
+}
 
-    /* 2) 待機後にハード由来の揺らぎを混ぜて seed を生成 */
-    u32 seed = 0x9E3779B9u;
+void rng_stream_init(RngStream* st, u32 seed, u32 index){
+    /* シードを 4 語に拡散（全 0 にはならないが念のため） */
+    for (int i = 0; i < 4; ++i) st->s[i] = avalanche_(seed + 0x9E3779B9u * (u32)(i + 1));
+    if (!(st->s[0] | st->s[1] | st->s[2] | st->s[3])) st->s[0] = 1;
+    while (index--) rng_stream_jump(st);
+}
 
-    /* VCOUNT/TM0/DIV を何度かサンプリングして拡散 */
-    for (int i = 0; i < 64; ++i){
-        /* 極軽いスピンでサンプリング位相をずらす */
-        u32 spin = (seed ^ 0x27D4EB2Du) & 0x3FFu;
-        while (spin--) { __asm__ volatile ("":::"memory"); }
+void rng_stream_jump(RngStream* st){
+    u32 a[4] = { 0, 0, 0, 0 };
+    for (int w = 0; w < 4; ++w){
+        for (int b = 0; b < 32; ++b){
+            if (kJump[w] & (1u << b)){
+                a[0] ^= st->s[0]; a[1] ^= st->s[1]; a[2] ^= st->s[2]; a[3] ^= st->s[3];
+            }
+            next_(st->s);
+        }
+    }
+    for (int i = 0; i < 4; ++i) st->s[i] = a[i];
+}
 
-        u32 mix = REG_DIV ^ ((u32)REG_TM0CNT_L << 16) ^ (u32)REG_VCOUNT;
-        seed ^= mix;
-        seed = seed * 1664525u + 1013904223u; /* LCGで拡散 */
+u32 rng_stream_next(RngStream* st){
+    return next_(st->s);
+}
+
+IWRAM_CODE
+u32 rng_stream_below(RngStream* st, u32 span){
+    if (span == 0) return 0;
+    /* 32x32→64 の上位が答え。下位が 2^32 mod span 未満のときだけ引き直す */
+    u64 m = (u64)next_(st->s) * span;
+    u32 l = (u32)m;
+    if (l < span){
+        u32 t = (0u - span) % span;
+        while (l < t){
+            m = (u64)next_(st->s) * span;
+            l = (u32)m;
+        }
     }
+    return (u32)(m >> 32);
+}
 
-    /* 最後にビット分散（Avalanche）＋全0回避 */
-    seed ^= (seed >> 16);
-    seed *= 0x45D9F3Bu;
-    seed ^= (seed >> 16);
-    if (seed == 0) seed = 2463534242u;
+RngStream* rng_stream(int id){
+    if (!s_ready) rng_set_seed(0);
+    if ((unsigned)id >= RNG_STREAM_COUNT) id = RNG_STREAM_MAIN;
+    return &s_streams[id];
 }
 
-/* --- 32bit 乱数を返す（xorshift32）--- */
+/* --- 32bit 乱数を返す（RNG_STREAM_MAIN）--- */
 u32 rng_next(void){
-    u32 x = s_rng_state;
-    x ^= x << 13;
-    x ^= x >> 17;
-    x ^= x << 5;
-    s_rng_state = x;
-    return x;
+    return next_(rng_stream(RNG_STREAM_MAIN)->s);
 }
 
 /* --- (lo, hi) の半開区間で一様乱数を返す（hi <= lo の場合は lo を返す）--- */
 int rng_range(int lo, int hi){
     if (hi <= lo) return lo;
-    u32 span = (u32)(hi - lo);
-    return lo + (int)(rng_next() % span);
+    return lo + (int)rng_stream_below(rng_stream(RNG_STREAM_MAIN), (u32)(hi - lo));
 }
 
 
@@ -0,0 +1,55 @@
+#include "scratch.h"
+
+/* ereader.ld が定義する .initdata 先頭 / .initbss 末尾 */
+extern u8 __init_start[];
+extern u8 __init_end[];
+
+/* ================= 内部状態 ================= */
+
+static u8* s_base = NULL;
+static u32 s_cap  = 0;
+static u32 s_used = 0;
+static ScratchStats s_stats;
+
+#ifdef HOST_BUILD
+/* ホストでは ereader.ld を使わないので、回収範囲の代わりの配列 */
+#define SCRATCH_HOST_BYTES (16u * 1024u)
+static u8 s_host_scratch[SCRATCH_HOST_BYTES] __attribute__((aligned(4)));
+#endif
+
+/* =============== 公開 API =============== */
+
+void scratch_reclaim_init(void){
+#ifdef HOST_BUILD
+  s_base = s_host_scratch;
+  s_cap  = SCRATCH_HOST_BYTES;
+#else
+  u32 a = ((u32)__init_start + 3u) & ~3u;
+  u32 e = (u32)__init_end & ~3u;
+  s_base = (u8*)a;
+  s_cap  = (e > a) ? e - a : 0;
+#endif
+  s_used = 0;
+  s_stats.capacity = s_cap;
+  s_stats.used = s_stats.peak = s_stats.failures = 0;
+}
+
+void* scratch_alloc(u32 bytes){
+  bytes = (bytes + 3u) & ~3u;
+  if (!s_base || bytes > s_cap - s_used){ s_stats.failures++; return NULL; }
+  void* p = s_base + s_used;
+  s_used += bytes;
+  s_stats.used = s_used;
+  if (s_used > s_stats.peak) s_stats.peak = s_used;
+  return p;
+}
+
+void scratch_reset(void){
+  s_used = 0;
+  s_stats.used = 0;
+}
+
+void scratch_get_stats(ScratchStats* out){
+  if (!out) return;
+  *out = s_stats;
+}
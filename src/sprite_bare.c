@@ -7,9 +7,8 @@ void spr_init_mode0_obj1d(void){
 }
 
 void spr_wait_vblank(void){
-  // VDraw(0..159)を抜けてVBlankに入るのを待つ
-  while(REG_VCOUNT >= 160);
-  while(REG_VCOUNT < 160);
+  // 次の VBlank 割り込みまで CPU を止めて待つ（VCOUNT を回して待たない）
+  __asm__ volatile("swi 0x05" ::: "r0", "r1", "r2", "r3", "memory");
 }
 
 void spr_dma_copy32(void* dst, const void* src, uint32_t words){